@@ -215,6 +215,12 @@ function advanced() {
         getItem("networkmore_status").style.display = 'block';
         getItem("networkmore_deviceid").style.display = 'block';
         getItem("networkmore_retain").style.display = 'block';
+        getItem("networkmore_filter").style.display = 'block';
+        getItem("networkmore_timeout").style.display = 'block';
+        getItem("networkmore_maxdevices").style.display = 'block';
+        getItem("networkmore_beaconid").style.display = 'block';
+        getItem("networkmore_fusion").style.display = 'block';
+        getItem("networkmore_batch").style.display = 'block';
 
         getItem("advancednet").style.display = 'none';
         getItem("basicnet").style.display = 'block';
@@ -226,6 +232,12 @@ function advanced() {
         getItem("networkmore_status").style.display = 'none';
         getItem("networkmore_deviceid").style.display = 'none';
         getItem("networkmore_retain").style.display = 'none';
+        getItem("networkmore_filter").style.display = 'none';
+        getItem("networkmore_timeout").style.display = 'none';
+        getItem("networkmore_maxdevices").style.display = 'none';
+        getItem("networkmore_beaconid").style.display = 'none';
+        getItem("networkmore_fusion").style.display = 'none';
+        getItem("networkmore_batch").style.display = 'none';
         
         getItem("advancednet").style.display = 'block';
         getItem("basicnet").style.display = 'none';
@@ -1,16 +1,18 @@
 #!/usr/bin/python
-# pip install htmlmin
-# pip install cssmin
-# pip install jsmin
-# if platformIO has a different python instance, use this  C:\Users\redma\.platformio\penv\Scripts\pip.exe install htmlmin
+# Minifies and gzips the web files into src/webcontent.h (only the standard library is used)
+# Every file gets its gzipped bytes, their length and an ETag (content hash), the webserver sends them with
+# Content-Encoding: gzip and answers 304 if the browser has the same version (If-None-Match)
 
 import os
 import re
+import gzip
+import hashlib
 import binascii
 import subprocess
 
 input_dir = "html"              # Sub folder of webfiles
 output_file = "src/webcontent.h"
+link_speed = 1000000            # bit/s, estimated WiFi throughput for the transfer time report (BLE coexistence)
 
 
 # version and revision extract
@@ -64,71 +66,79 @@ def replaceWildCards(string):
 def write_to_file(file, data, dir=""):
     filename, file_extension = os.path.splitext(file)       # Split filename and file extension
     file_extension = file_extension.replace(".","")         # Remove puncuation in file extension
+    name = "data_" + filename + "_" + file_extension
 
     dir = dir.replace(input_dir,"")                         # Remove the first directory(input_dir)
     dir = dir.replace("\\","/")                             # Change to /
     if (dir == "/index."):
         dir="/index.html"
-    f_output.write("// " + dir + "\n")                      # Print comment
-    f_output.write("const char* const data_" + filename + "_" + file_extension + "_path PROGMEM = \""+str(dir)+"\";\n")    # print path
-    f_output.write("const char data_"+filename+"_"+file_extension+"[] PROGMEM = "+data+"\n\n")            # print binary data
 
-    # f_output.write("#define data_" + filename + "_len " + str(data.count('0x')) +"\n")
+    compressed = gzip.compress(data.encode("utf-8"), 9, mtime=0)       # mtime=0: same input, same bytes (ETag)
+    etag = hashlib.sha256(compressed).hexdigest()[:16]
 
-def aschii2Hex(text):
-    output_str = ""
-    x = 1
-    strLen = len(text)
-    for character in text:
-        output_str += hex(ord(character))
+    f_output.write("// " + dir + "\n")                      # Print comment
+    f_output.write("const char* const " + name + "_path PROGMEM = \""+str(dir)+"\";\n")    # print path
+    f_output.write("const char* const " + name + "_etag PROGMEM = \"\\\"" + etag + "\\\"\";\n")  # strong ETag, quoted
+    f_output.write("const size_t " + name + "_len = " + str(len(compressed)) + ";\n")
+    f_output.write("const uint8_t " + name + "[] PROGMEM = {" + bytes2Hex(compressed) + "};\n\n")     # gzipped data
+    return len(compressed)
+
+def bytes2Hex(data):
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append(",".join("0x%02x" % byte for byte in data[i:i + 32]))
+    return "\n" + ",\n".join(lines) + "\n"
+
+def read_source(input_file):
+    with open (input_file, "r") as sourceFile:
+        return replaceWildCards(sourceFile.read())
 
-        if (x != strLen):
-            output_str += ","
-        x += 1
-    return output_str
+# Whitespace is only removed where it does not change the meaning, the line breaks are kept (JavaScript ASI)
+def strip_lines(text):
+    lines = [line.strip() for line in text.split("\n")]
+    return "\n".join(line for line in lines if line != "")
 
 def minify_js(input_file):
-    data = "R\"=====(\n"
-    sourceFile = open (input_file, "r")
-    with open (input_file, "r") as sourceFile:
-        data+=replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
-    sourceFile.close()
-    data += "\n)=====\";"
-    return data
+    text = strip_lines(read_source(input_file))
+    return "\n".join(line for line in text.split("\n") if not line.startswith("//"))    # whole line comments
 
-def minify_html(input_file):    
-    data = "R\"=====(\n"
-    with open (input_file, "r") as sourceFile:
-        data+=replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
-    sourceFile.close()
-    
-    data += "\n)=====\";"
-    return data
+def minify_html(input_file):
+    text = re.sub(r"<!--.*?-->", "", read_source(input_file), flags=re.DOTALL)
+    return strip_lines(text)
 
 def minify_css(input_file):
-    data = "R\"=====(\n"
-    with open (input_file, "r") as sourceFile:
-        data+=replaceWildCards(sourceFile.read().replace('  ', '').replace('\t', '').replace('\n\n', '\n'))
-    sourceFile.close()
-    
-    data += "\n)=====\";"
-    return data
+    text = re.sub(r"/\*.*?\*/", "", read_source(input_file), flags=re.DOTALL)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    text = re.sub(r":\s+", ":", text)
+    return text.replace(";}", "}").strip()
+
+def transfer_ms(length):
+    return length * 8 * 1000.0 / link_speed
+
+total_original = 0
+total_compressed = 0
+
+def report(path, original, minified, compressed):
+    global total_original, total_compressed
+    total_original += original
+    total_compressed += compressed
+    print("%-20s %6d -> minified %6d -> gzip %6d bytes (-%d%%, ~%.0f ms -> %.0f ms at %d kbit/s)" % (
+        path, original, minified, compressed, 100 - compressed * 100 // max(original, 1),
+        transfer_ms(original), transfer_ms(compressed), link_speed // 1000))
+
+minifiers = {".js": minify_js, ".html": minify_html, ".css": minify_css}
 
 for root, dirs, files in os.walk(input_dir, topdown=False):
-    for name in files:   # for files
-        if name.endswith(".js"):
-            print(os.path.join(root, name))
-            minified = minify_js(os.path.join(root, name))          # minify javascript
-            write_to_file(name, minified, os.path.join(root, name)) # write to file
-
-        elif name.endswith(".html"):
-            print(os.path.join(root, name))
-            minified = minify_html(os.path.join(root, name))        # minify html
-            write_to_file(name, minified, os.path.join(root, name)) # write to file
-
-        elif name.endswith(".css"):
-            print(os.path.join(root, name))
-            minified = minify_css(os.path.join(root, name))         # minify css
-            write_to_file(name, minified, os.path.join(root, name)) # write to file
+    for name in sorted(files):   # for files
+        extension = os.path.splitext(name)[1]
+        if extension in minifiers:
+            path = os.path.join(root, name)
+            minified = minifiers[extension](path)
+            compressed = write_to_file(name, minified, path) # write to file
+            report(path, os.path.getsize(path), len(minified.encode("utf-8")), compressed)
+
+print("Web content: %d -> %d bytes, ~%.0f ms less per full page load at %d kbit/s" % (
+    total_original, total_compressed, transfer_ms(total_original - total_compressed), link_speed // 1000))
 
 f_output.close()
\ No newline at end of file
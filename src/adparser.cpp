@@ -0,0 +1,161 @@
+#ifndef ADPARSER
+#define ADPARSER
+
+#include <Arduino.h>
+#include <stdint.h>
+#include "utilities.cpp"
+
+#define AD_TYPE_SERVICE_DATA_16 0x16
+#define AD_TYPE_MANUFACTURER_DATA 0xFF
+
+#define BEACON_IBEACON 1
+#define BEACON_EDDYSTONE 2
+
+// One AD structure of the advertisement payload. data points into the payload, nothing is copied.
+struct AdField {
+    uint8_t type;
+    uint8_t length;         // length of the data
+    const uint8_t* data;
+};
+
+// Walks the AD structures (length, type, data) of the raw advertisement (+ scan response) payload in place.
+// Malformed or truncated structures stop the walk.
+class AdParser {
+
+    const uint8_t* payload;
+    uint8_t length;
+    uint8_t position = 0;
+
+    public:
+        AdParser(const uint8_t* payload, uint8_t length) : payload(payload), length(length) {
+        }
+
+        boolean next(AdField &field) {
+            if (position >= length) {
+                return false;
+            }
+
+            uint8_t fieldLength = payload[position]; // type + data
+            if (fieldLength == 0 || position + 1 + fieldLength > length) {
+                return false;
+            }
+
+            field.type = payload[position + 1];
+            field.length = fieldLength - 1;
+            field.data = payload + position + 2;
+            position += fieldLength + 1;
+            return true;
+        }
+};
+
+// Identity key of a beacon: 63 bit FNV-1a hash of the beacon type and the identity bytes with the top bit set,
+// so it never collides with a 48 bit MAC key. Devices can be keyed on it instead of the (rotating) address.
+static inline uint64_t identityKey(uint8_t beaconType, const uint8_t* data, uint8_t length) {
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    hash = (hash ^ beaconType) * 0x100000001B3ULL;
+    for (uint8_t i = 0; i < length; i++) {
+        hash = (hash ^ data[i]) * 0x100000001B3ULL;
+    }
+    return hash | IDENTITY_KEY_FLAG;
+}
+
+// Identity key of an iBeacon (UUID, major, minor) or an Eddystone-UID (namespace, instance) advertisement.
+// Returns 0 for the other devices.
+static inline uint64_t beaconIdentity(const uint8_t* payload, uint8_t length) {
+    AdParser parser(payload, length);
+    AdField field;
+    while (parser.next(field)) {
+        // Apple company id (0x004C little endian), type 0x02, length 0x15: UUID (16), major (2), minor (2), TX power
+        if (field.type == AD_TYPE_MANUFACTURER_DATA && field.length >= 25
+            && field.data[0] == 0x4C && field.data[1] == 0x00 && field.data[2] == 0x02 && field.data[3] == 0x15) {
+            return identityKey(BEACON_IBEACON, field.data + 4, 20);
+        }
+        // Eddystone service (0xFEAA little endian), UID frame (0x00), TX power, namespace (10), instance (6)
+        if (field.type == AD_TYPE_SERVICE_DATA_16 && field.length >= 20
+            && field.data[0] == 0xAA && field.data[1] == 0xFE && field.data[2] == 0x00) {
+            return identityKey(BEACON_EDDYSTONE, field.data + 4, 16);
+        }
+    }
+    return 0;
+}
+
+// Parse "count" bytes of hex digits, "-" separators are skipped. Returns the position after the digits or NULL.
+static inline const char* parseHexBytes(const char* text, uint8_t* bytes, uint8_t count) {
+    uint8_t digits = 0;
+    while (digits < count * 2) {
+        if (*text == '-') {
+            text++;
+            continue;
+        }
+        if (!isHexadecimalDigit(*text)) {
+            return NULL;
+        }
+        uint8_t value = (*text <= '9') ? (*text - '0') : ((*text | 0x20) - 'a' + 10);
+        bytes[digits / 2] = (digits % 2 == 0) ? (value << 4) : (bytes[digits / 2] | value);
+        digits++;
+        text++;
+    }
+    return text;
+}
+
+// Parse a 16 bit decimal number into 2 bytes, big endian (as it is on the air). Returns the position after it or NULL.
+static inline const char* parseUint16(const char* text, uint8_t* bytes) {
+    if (!isDigit(*text)) {
+        return NULL;
+    }
+    uint32_t value = 0;
+    while (isDigit(*text)) {
+        value = value * 10 + (*text - '0');
+        if (value > 0xFFFF) {
+            return NULL;
+        }
+        text++;
+    }
+    bytes[0] = value >> 8;
+    bytes[1] = value & 0xFF;
+    return text;
+}
+
+// Key of an observed device entry. Formats:
+//   MAC address:   317234b9d2d0 or 31:72:34:b9:d2:d0
+//   iBeacon:       ibeacon:f7826da6-4fa2-4e98-8024-bc5b71e0893e:100:1 (UUID:major:minor)
+//   Eddystone-UID: eddystone:edd1ebeac04e5defa017:0123456789ab (namespace:instance)
+//   Identity key:  16 hex digits, as it is in the MQTT topic of a beacon
+static inline boolean parseDeviceId(const char* text, uint64_t &key) {
+    uint8_t identity[20];
+
+    if (strncasecmp(text, "ibeacon:", 8) == 0) {
+        const char* c = parseHexBytes(text + 8, identity, 16);
+        if (c == NULL || *c != ':' || (c = parseUint16(c + 1, identity + 16)) == NULL
+            || *c != ':' || (c = parseUint16(c + 1, identity + 18)) == NULL || *c != '\0') {
+            return false;
+        }
+        key = identityKey(BEACON_IBEACON, identity, 20);
+        return true;
+    }
+
+    if (strncasecmp(text, "eddystone:", 10) == 0) {
+        const char* c = parseHexBytes(text + 10, identity, 10);
+        if (c == NULL || *c != ':' || (c = parseHexBytes(c + 1, identity + 10, 6)) == NULL || *c != '\0') {
+            return false;
+        }
+        key = identityKey(BEACON_EDDYSTONE, identity, 16);
+        return true;
+    }
+
+    if (strlen(text) == 16) {
+        const char* c = parseHexBytes(text, identity, 8);
+        if (c == NULL || *c != '\0' || (identity[0] & 0x80) == 0) {
+            return false;
+        }
+        key = 0;
+        for (int i = 0; i < 8; i++) {
+            key = (key << 8) | identity[i];
+        }
+        return true;
+    }
+
+    return parseMac(text, key);
+}
+
+#endif
@@ -16,6 +16,7 @@
 #include "webserver.cpp"
 #include "mqtt.cpp"
 #include "webhook.cpp"
+#include "fusion.cpp"
 #include "esp_log.h"
 
 Log rlog;
@@ -26,20 +27,52 @@ Webserver webserver(rlog);
 BlueTooth blueTooth(rlog, led);
 Mqtt mqtt(rlog);
 Webhook webhook(rlog);
+Fusion fusion(rlog);
 
 // This signal will be emitted when we process characters
 // https://github.com/tomstewart89/Callback
 Signal<boolean> wifiStatusChanged;
 Signal<int> errorCodeChanged;
-Signal<String> messageArrived;
+Signal<char*> messageArrived;
+Signal<MQTTInboundMessage> topicMessageArrived;
 Signal<MQTTMessage> mqttMessageSend;
+Signal<StateMessage> stateMessageSend;
 Signal<Device> deviceChanged;
 Signal<String> ipAddressChanged;
+Signal<JsonObject> statsRequested;
 
 String log_prefix = "[MAIN]";
+Logger logger(rlog, "[MAIN]");
 
 int rebootAfterHours = 0;
 
+// Worst loop() run time in the current LOOP_STATS_INTERVAL, in the previous one and since the boot (/stats)
+unsigned long loopLatencyMax = 0;
+unsigned long loopLatencyLast = 0;
+unsigned long loopLatencyBoot = 0;
+const char* loopSlowest = "";      // object which loop() was the slowest one in the worst loop() since the boot
+unsigned long lastLoopStats = 0;
+
+// Object loop() run times of the current loop()
+const char* loopStepSlowest = "";
+unsigned long loopStepMax = 0;
+
+void timeLoopStep(const char* name, unsigned long start) {
+  unsigned long duration = micros() - start;
+  if (duration > loopStepMax) {
+    loopStepMax = duration;
+    loopStepSlowest = name;
+  }
+}
+
+void fillLoopStats(JsonObject stats) {
+  JsonObject loopStats = stats.createNestedObject("loop");
+  loopStats["worst_us"] = loopLatencyMax;
+  loopStats["worst_last_interval_us"] = loopLatencyLast;
+  loopStats["worst_since_boot_us"] = loopLatencyBoot;
+  loopStats["slowest"] = loopSlowest;
+}
+
 void setup() {
   // callback(s)
 
@@ -57,12 +90,18 @@ void setup() {
 
   // MQTT and Bluetooth command handling
   // Arrive  
-  MethodSlot<Database, String> messageSendForDatabase(&database,&Database::receiveCommand);
+  MethodSlot<Database, char*> messageSendForDatabase(&database,&Database::receiveCommand);
   messageArrived.attach(messageSendForDatabase);
+  MethodSlot<Fusion, MQTTInboundMessage> topicMessageArrivedForFusion(&fusion,&Fusion::messageArrived);
+  topicMessageArrived.attach(topicMessageArrivedForFusion);
+  MethodSlot<BlueTooth, MQTTInboundMessage> topicMessageArrivedForBluetooth(&blueTooth,&BlueTooth::messageArrived);
+  topicMessageArrived.attach(topicMessageArrivedForBluetooth);
 
   // Send
   MethodSlot<Mqtt, MQTTMessage> mqttMessageSendForMqtt(&mqtt,&Mqtt::sendMqttMessage);
   mqttMessageSend.attach(mqttMessageSendForMqtt);
+  MethodSlot<Mqtt, StateMessage> stateMessageSendForMqtt(&mqtt,&Mqtt::sendState);
+  stateMessageSend.attach(stateMessageSendForMqtt);
 
   MethodSlot<Webhook, Device> deviceChangedForWebhook(&webhook,&Webhook::callWebhook);
   deviceChanged.attach(deviceChangedForWebhook);
@@ -70,16 +109,36 @@ void setup() {
   MethodSlot<Mqtt, String> ipAddressChangedForMqtt(&mqtt,&Mqtt::ipAddressChanged);
   ipAddressChanged.attach(ipAddressChangedForMqtt);
 
+  // Runtime statistics (/stats)
+  MethodSlot<BlueTooth, JsonObject> statsRequestedForBluetooth(&blueTooth,&BlueTooth::fillStats);
+  statsRequested.attach(statsRequestedForBluetooth);
+  MethodSlot<Mqtt, JsonObject> statsRequestedForMqtt(&mqtt,&Mqtt::fillStats);
+  statsRequested.attach(statsRequestedForMqtt);
+  MethodSlot<Database, JsonObject> statsRequestedForDatabase(&database,&Database::fillStats);
+  statsRequested.attach(statsRequestedForDatabase);
+  FunctionSlot<JsonObject> statsRequestedForLoop(fillLoopStats);
+  statsRequested.attach(statsRequestedForLoop);
+
   rlog.setup();
   led.setup();
   database.setup();
   wifi.setup(database, wifiStatusChanged, errorCodeChanged, ipAddressChanged);
-  blueTooth.setup(database, mqttMessageSend, deviceChanged);  
+  // Before the BlueTooth: the device states of the setup are written with the payloads of the Mqtt
+  mqtt.setup(database, errorCodeChanged, messageArrived, topicMessageArrived);
+  blueTooth.setup(database, mqttMessageSend, stateMessageSend, deviceChanged);  
   // Must be after Wifi setup
-  webserver.setup(database);
+  webserver.setup(database, statsRequested);
   webhook.setup(database);
   
-  mqtt.setup(database, errorCodeChanged, messageArrived);
+  mqtt.setQueueCapacity(blueTooth.getCapacity());
+  fusion.setup(database, mqttMessageSend);
+  if (database.getValueAsInt(DB_FUSION_MODE) == FUSION_MODE_FUSE) {
+    mqtt.addSubscription(Fusion::getFusionTopic(database) + FUSION_NODE_POSTFIX + "/#");
+  }
+  // Birth message of Home Assistant
+  if (blueTooth.getDiscoveryStatusTopic().length() > 0) {
+    mqtt.addSubscription(blueTooth.getDiscoveryStatusTopic());
+  }
   // Connect to WiFi
   wifi.connectWifi();
 
@@ -88,15 +147,46 @@ void setup() {
 }
 
 void loop() {  
+  unsigned long loopStart = micros();
+  loopStepMax = 0;
+
   // Object loops
   rlog.loop();
   led.loop();
   database.loop();
+  unsigned long stepStart = micros();
   wifi.loop();
+  timeLoopStep("wifi", stepStart);
+  stepStart = micros();
   blueTooth.loop();  
+  timeLoopStep("bluetooth", stepStart);
+  stepStart = micros();
   webserver.loop();
+  timeLoopStep("webserver", stepStart);
+  stepStart = micros();
   mqtt.loop();
+  timeLoopStep("mqtt", stepStart);
+  stepStart = micros();
   webhook.loop();
+  timeLoopStep("webhook", stepStart);
+  stepStart = micros();
+  fusion.loop();
+  timeLoopStep("fusion", stepStart);
+
+  unsigned long loopLatency = micros() - loopStart;
+  if (loopLatency > loopLatencyMax) {
+    loopLatencyMax = loopLatency;
+  }
+  if (loopLatency > loopLatencyBoot) {
+    loopLatencyBoot = loopLatency;
+    loopSlowest = loopStepSlowest;
+  }
+  if (millis() - lastLoopStats > LOOP_STATS_INTERVAL) {
+    logger << "Worst loop latency: " << (String)loopLatencyMax << " us";
+    loopLatencyLast = loopLatencyMax;
+    loopLatencyMax = 0;
+    lastLoopStats = millis();
+  }
 
   if ((rebootAfterHours > 0) && (millis() > (rebootAfterHours * 60 * 60 * 1000))) {
     ESP.restart();
@@ -3,69 +3,88 @@
 
 #include "definitions.h"
 #include "utilities.cpp"
+#include "presence.cpp"
+#include "scanner.cpp"
+#include "trace.cpp"
+#include "fusion.cpp"
+#include "snapshot.cpp"
 #include "BluetoothSerial.h" // Header File for Serial Bluetooth
-#include "LinkedList.h"
 #include "log.hpp"
 #include "led.cpp"
 #include "database.cpp"
 #include <Callback.h>
-#include <BLEDevice.h>
-#include <BLEUtils.h>
-#include <BLEScan.h>
-#include <BLEAdvertisedDevice.h>
 
 
-class BlueTooth: public BLEAdvertisedDeviceCallbacks {
+// Connects the scanner and the presence logic, sends the results over MQTT and to the other consumers
+class BlueTooth: public PresenceListener {
 
     Logger logger;
     Led* led;
     Signal<MQTTMessage>* mqttMessageSend;
+    Signal<StateMessage>* stateMessageSend;     // device states, see Mqtt::sendState()
     Signal<Device>* deviceChanged;
-    BLEScan* pBLEScan;
     Database* database;
 
     BluetoothSerial blueToothSerial; // Object for Bluetooth
     String command;
-    long lastRun = 0;
-    long lastClear = 0;
-    long lastSendDeviceData = 0;
-    int scanAfter = BT_DEFAULT_SCAN_INTERVAL;
+    unsigned long lastReconcile = 0;
+    unsigned long lastSendDeviceData = 0;
     
+    // Home Assistant discovery configs are sent when a device is found, after a config change and after the birth message of HA.
+    // A full resend walks the device table, one device in every HA_AUTODISCOVERY_STEP ms.
     boolean sendAutoDiscovery = false;
-    long lastSendAutoDiscovery = 0;
-    String autoDiscoveryPrefix = "";
+    String autoDiscoveryPrefix = HA_DEFAULT_PREFIX;
+    int discoveryNext = 0;                  // next device of the full resend, -1: no resend is running
+    uint32_t discoveryStartAt = 0;          // millis(), the resend starts at this time
+    uint32_t lastDiscoveryStep = 0;
+    uint32_t nextDiscoveryRefresh = 0;
+    uint32_t discoveryMessages = 0;
     // This is not the best place here. This object should not know this, but autodiscover must use it.
     // You mut not use any other place in the object
     String mqttBaseTopic = "";
 
     boolean detailedReport = false;
+    PresenceStrings presenceStrings;    // payloads of the state messages
 
-    boolean monitorObservedOnly = false; // Monitor devices only which are configured in the database
+    // Multi-node room level presence: RSSI summary of this node
+    boolean publishRssi = false;
+    String rssiSummaryTopic = "";
+    unsigned long lastRssiSummary = 0;
+
+    // Batch publishing: one document per scan cycle, see snapshot.cpp
+    uint8_t batchMode = BATCH_MODE_OFF;
+    String batchTopic = BATCH_DEFAULT_TOPIC;
+    boolean batchIndividualTopic = false;   // batchTopic is a full topic (not under the base topic)
+    uint32_t lastCycle = 0;
+    Snapshot snapshot;
 
     boolean networkConnected = false; // Connected to the network (Wifi STA)
 
-    LinkedList<Device> devices = LinkedList<Device>();
-    LinkedList<int> devicesToRemove = LinkedList<int>();
+    BleScanner bleScanner;
+    Scanner* scanner;
+    TraceRecorder recorder;
+    Presence presence;
 
     public:
-        BlueTooth(Log& rlog, Led& led) : logger(rlog, "[BLUE]") {
+        BlueTooth(Log& rlog, Led& led) : logger(rlog, "[BLUE]"), bleScanner(rlog), recorder(rlog) {
             this -> led = &led;
+            this -> scanner = &bleScanner;
         }
 
-        void setup(Database &database, Signal<MQTTMessage> &mqttMessageSend, Signal<Device> &deviceChanged) {
+        void setup(Database &database, Signal<MQTTMessage> &mqttMessageSend, Signal<StateMessage> &stateMessageSend, Signal<Device> &deviceChanged) {
 
             this -> mqttMessageSend = &mqttMessageSend;
+            this -> stateMessageSend = &stateMessageSend;
             this -> deviceChanged = &deviceChanged;
             this -> database = &database;
+            presenceStrings.load(database);
            
-            BLEDevice::init(BOARD_NAME);
-            pBLEScan = BLEDevice::getScan(); //create new scan            
-            pBLEScan->setAdvertisedDeviceCallbacks(this);
-            pBLEScan->setActiveScan(true); //active scan uses more power, but get results faster
-            pBLEScan->setInterval(100);
-            pBLEScan->setWindow(99);  // less or equal setInterval value
-
-            logger << BOARD_NAME " is initiated";
+            presence.setup(*this, millis());
+            configurePresence();
+            scanner -> setup();
+            recorder.setup(database);
+            // After the BLE stack init, it takes a big part of the heap
+            configureCapacity();
 
             // Prefill the device list with the user's devices
             // In case of accidently reboot it will send a "not_home" message if the device is gone meanwhile
@@ -77,14 +96,18 @@ class BlueTooth: public BLEAdvertisedDeviceCallbacks {
             // Owner upload the device names which must be observed, so we prefill the list and on the next scan will set them as gone if the story happens above
 
             // Devices in this format: 317234b9d2d0;15172f81accc;d0e003795c50            
-            fillDevices(database.getValueAsString(DB_DEVICES));
+            fillDevices();
             // Parse the sting, split by ;
 
             // Auto discovery for Home Assistant is available.
             // Set it tru if the user enabled it
             sendAutoDiscovery = (database.getValueAsInt(DB_HA_AUTODISCOVERY) > 0) ? true : false;
             if (sendAutoDiscovery) {
-                autoDiscoveryPrefix = database.getValueAsString(DB_HA_AUTODISCOVERY_PREFIX);
+                String prefix = database.getValueAsString(DB_HA_AUTODISCOVERY_PREFIX);
+                if (prefix.length() > 0) {
+                    autoDiscoveryPrefix = prefix;
+                }
+                scheduleDiscoveryRefresh();
             }
 
             // This is not the best place here. This object should not know this, but autodiscover must use it.
@@ -92,62 +115,73 @@ class BlueTooth: public BLEAdvertisedDeviceCallbacks {
             this -> mqttBaseTopic = this -> database -> getValueAsString(String(DB_MQTT_TOPIC_PREFIX), false) + MQTT_TOPIC;
 
             detailedReport = (database.getValueAsInt(DB_DETAILED_REPORT) > 0) ? true : false;
+
+            publishRssi = database.getValueAsInt(DB_FUSION_MODE) >= FUSION_MODE_PUBLISH;
+            if (publishRssi) {
+                String room = database.getValueAsString(DB_ROOM);
+                room = (room.length() > 0) ? room : String(BOARD_NAME);
+                rssiSummaryTopic = Fusion::getFusionTopic(database) + FUSION_NODE_POSTFIX + "/" + room;
+                logger << "RSSI summary is published to " << rssiSummaryTopic;
+            }
+
+            int batch = database.getValueAsInt(DB_BATCH_MODE);
+            if (batch == BATCH_MODE_BOTH || batch == BATCH_MODE_ONLY) {
+                batchMode = batch;
+                String topic = database.getValueAsString(DB_BATCH_TOPIC);
+                if (topic.length() > 0) {
+                    batchTopic = topic;
+                    batchIndividualTopic = true;
+                }
+                logger << "Snapshot is published to " << batchTopic << ((batchMode == BATCH_MODE_ONLY) ? ", no per device messages" : "");
+            }
             
         }
 
         void loop() {
 
-            if (millis() - lastRun > scanAfter) {
-                // Otherwise makes no sens to scan and sent it over
-                if (networkConnected) {
-                    BLEScanResults foundDevices = pBLEScan->start(5, false);            
-                    pBLEScan->clearResults();   // delete results fromBLEScan buffer to release memory
-                    lastRun = millis();
+            // Otherwise makes no sens to scan and sent it over
+            scanner -> loop(networkConnected);
+            recorder.loop(networkConnected);
+
+            // Process the advertisements collected by the scanner
+            Advertisement advertisement;
+            while (scanner -> next(advertisement)) {
+                recorder.record(advertisement);
+                presence.advertisement(advertisement);
+            }
+
+            presence.loop(millis());
+
+            // Settings changed (web or MQTT config command)
+            if (database -> getConfig().version != presenceStrings.version) {
+                PresenceStrings previous = presenceStrings;
+                presenceStrings.load(*database);
+                if (previous.present != presenceStrings.present || previous.notPresent != presenceStrings.notPresent) {
+                    // Payloads are in the discovery configs
+                    startDiscovery(0);
                 }
+                fillDevices();
             }
 
-            // Find the expired devices
-            for (int i = 0; i < this -> devices.size(); i++) {
-                
-                Device dev = devices.get(i);
-                
-                if (millis() - dev.lastSeen > BT_DEVICE_TIMEOUT || (long) millis() - (long) dev.lastSeen < 0) {
-
-                    // Give another chance to the device to appear (Device has DEVICE_DROP_OUT_COUNT lives in the beginning)
-                    dev.mark--;
-                    dev.lastSeen = millis();
-
-                    if (dev.mark == 0) {
-                        logger << "Device is gone. MAC: " << dev.mac;
-                        
-                        // Virtually remove the device
-                        dev.available = false;
-                        dev.rssi = "0";
-                        devices.set(i, dev);
-
-                        // Send an MQTT message about this device is NOT at home
-                        handleDeviceChange(dev);
-
-                    } 
-                    if (dev.mark > 0) {
-                        logger << "Device marked as gone. MAC: " << dev.mac << " Current mark is: " << (String)dev.mark;
-                        devices.set(i, dev);
-                    }
-                } 
+            if (batchMode != BATCH_MODE_OFF && scanner -> getCycles() != lastCycle) {
+                lastCycle = scanner -> getCycles();
+                publishSnapshot();
             }
             
-            if ((millis() - lastClear > BT_LIST_REBUILD_INTERVAL && devices.size() > 0) || (long) millis() - (long) lastClear < 0) {
-                lastClear = millis();
-                logger << "Clear the device list. (This is normal operation. :))";
-                // Clear the list, it will be rebuilt again. Resend the (available) status should not be a problem.
-                devices.clear();
-                fillDevices(this-> database -> getValueAsString(DB_DEVICES));
-                mqttMessageSend->fire(MQTTMessage{"selfclean", "true", false});
+            if (publishRssi && millis() - lastRssiSummary > FUSION_PUBLISH_INTERVAL) {
+                lastRssiSummary = millis();
+                publishRssiSummary();
+            }
+
+            // The observed list can be changed by an MQTT config command, reconcile the table time to time (in place, no resend)
+            if (millis() - lastReconcile > BT_LIST_REBUILD_INTERVAL) {
+                lastReconcile = millis();
+                fillDevices();
             }
             
             /*
             if (detailedReport) {
-                if ((millis() - lastSendDeviceData > BT_DEVICE_DATA_INTERVAL && devices.size() > 0) || (long) millis() - (long) lastSendDeviceData < 0) {
+                if (millis() - lastSendDeviceData > BT_DEVICE_DATA_INTERVAL && devices.size() > 0) {
                     lastSendDeviceData = millis();
                     logger << "Send device data.");
                     for (int i = 0; i < this -> devices.size(); i++) {
@@ -162,131 +196,308 @@ class BlueTooth: public BLEAdvertisedDeviceCallbacks {
             */
 
             if (sendAutoDiscovery) {
-                if ((millis() - lastSendAutoDiscovery > HA_AUTODISCOVERY_INTERVAL && devices.size() > 0) || (long) millis() - (long) lastSendAutoDiscovery < 0) {
-                    lastSendAutoDiscovery = millis();
-                    logger << "Send autodicovery data.";
-                    for (int i = 0; i < this -> devices.size(); i++) {
-                        Device dev = devices.get(i);
-                        // Example
-                        // mosquitto_pub -h 127.0.0.1 -t home-assistant/device_tracker/a4567d663eaf/config -m '{"state_topic": "a4567d663eaf/state", "name": "My Tracker", "payload_home": "home", "payload_not_home": "not_home"}'
-/*
-{
-              "name": "fd9be47e8fdc",
-              "state_topic": "blecker/fd9be47e8fdc",
-              "command_topic": "device_tracker/fd9be47e8fdc/",
-              "payload_on": "1",
-              "payload_off": "0",
-              "state_on": "home",
-              "state_off": "not_home",
-              "unique_id": "fd9be47e8fdc",
-              "device": {
-                  "identifiers": ["fd9be47e8fdc"],
-                  "name": "JBD fd9be47e8fdc",
-                  "model": "JBD1582",
-                  "manufacturer": "J-Style",
-                  "sw_version": "1.X"
-              }
-            }
-*/
-
-                        if (dev.mac != NULL) {
-                            String payload = "{\"state_topic\": \"" + mqttBaseTopic + "/" + dev.mac + "\", \"name\": \"" + dev.mac 
-							+ "\", \"unique_id\": \"" +  dev.mac 
-							+ "\", \"payload_home\": \"" +     this -> database->getValueAsString(DB_PRECENCE) 
-							+ "\", \"payload_not_home\": \"" + this -> database->getValueAsString(DB_NO_PRECENCE) 
-							+ "\", \"source_type\": \"bluetooth_le\"}";
-
-                            MQTTMessage autoDiscMessage = MQTTMessage{autoDiscoveryPrefix + "/device_tracker/" + dev.mac + "/config", payload, false, true};
-                            mqttMessageSend->fire(autoDiscMessage);
-                        }
+                uint32_t now = millis();
+                if (timeReached(now, nextDiscoveryRefresh)) {
+                    scheduleDiscoveryRefresh();
+                    startDiscovery(0);
+                }
+                if (discoveryNext >= 0 && timeReached(now, discoveryStartAt) && now - lastDiscoveryStep >= HA_AUTODISCOVERY_STEP) {
+                    lastDiscoveryStep = now;
+                    if (discoveryNext < presence.size()) {
+                        publishDiscovery(presence.get(discoveryNext++));
+                    } else {
+                        discoveryNext = -1;
                     }
                 }
             }
 
         }
 
+        // Device table limit
+        int getCapacity() {
+            return presence.getCapacity();
+        }
+
         void setConnected(boolean connected) {
             this -> networkConnected = connected;
         }
+
+        void fillStats(JsonObject stats) {
+            JsonObject ble = stats.createNestedObject("ble");
+            ble["devices"] = presence.size();
+            ble["capacity"] = presence.getCapacity();
+            ble["evictions"] = presence.getEvictions();
+            ble["suppressed_transitions"] = presence.getSuppressedTransitions();
+            if (sendAutoDiscovery) {
+                ble["discovery_messages"] = discoveryMessages;
+            }
+            scanner -> fillStats(ble);
+            recorder.fillStats(stats);
+        }
+
+        // PresenceListener
+        void deviceFound(const Device &device) {
+            logger << "New device found. MAC: " << keyToMac(device.mac);
+            if (sendAutoDiscovery) {
+                publishDiscovery(device);
+            }
+        }
+
+        // Birth message of Home Assistant: it lost the (not retained) discovery configs
+        void messageArrived(MQTTInboundMessage message) {
+            if (sendAutoDiscovery && strcmp(message.payload, HA_STATUS_ONLINE) == 0 && getDiscoveryStatusTopic().equals(message.topic)) {
+                logger << "Home Assistant is online, discovery configs are resent";
+                // Every node gets the birth message at the same time
+                startDiscovery(random(HA_BIRTH_JITTER));
+            }
+        }
+
+        // Empty if the discovery is not enabled
+        String getDiscoveryStatusTopic() {
+            return sendAutoDiscovery ? autoDiscoveryPrefix + HA_STATUS_POSTFIX : String("");
+        }
+
+        void deviceMarked(const Device &device) {
+            logger << "Device marked as gone. MAC: " << keyToMac(device.mac) << " Current mark is: " << (String)device.mark;
+        }
+
+        void presenceRefresh(const Device &device) {
+            if (batchMode == BATCH_MODE_ONLY) {
+                return;
+            }
+            // Only the retained state message, the other consumers are interested in the changes
+            stateMessageSend->fire(StateMessage{device.mac, device.available, LATENCY_NONE, 0, 0});
+        }
+
+        void presenceChanged(const Device &device) {
+            if (!device.available) {
+                logger << "Device is gone. MAC: " << keyToMac(device.mac);
+            }
+            // Send an MQTT message about this device
+            handleDeviceChange(device);
+        }
+
 private: 
-        
 
-        void onResult(BLEAdvertisedDevice advertisedDevice) {
-            // Serial.printf("Advertised Device: %s \n", advertisedDevice.toString().c_str());
-            //logger << "Found device MAC: " + advertisedDevice.getAddress().toString().c_str());
-            
-            boolean newFound = true;
-            String deviceMac = advertisedDevice.getAddress().toString().c_str();
-            deviceMac.toLowerCase();
-            String deviceName = advertisedDevice.getName().c_str();
-            String deviceRSSI = (String) advertisedDevice.getRSSI();
-            deviceMac.replace(":","");
-
-            for (int i = 0; i < this -> devices.size(); i++) {
-                Device dev = devices.get(i);
-                if (deviceMac == dev.mac) {
-
-                    // Device came back (state changed)
-                    if (!dev.available) {
-                        // Send an MQTT message about this device is at home
-                        dev.available = true;
-                        handleDeviceChange(dev);
-                    }
-                    dev.lastSeen = millis();
-                    dev.mark = DEVICE_DROP_OUT_COUNT;
-                    dev.available = true;
-                    devices.set(i, dev);                   
-                    newFound = false;
+        // Full resend of the discovery configs after delay ms (a running resend starts again)
+        void startDiscovery(uint32_t delay) {
+            discoveryNext = 0;
+            discoveryStartAt = millis() + delay;
+        }
+
+        void scheduleDiscoveryRefresh() {
+            nextDiscoveryRefresh = millis() + HA_AUTODISCOVERY_INTERVAL + random(HA_AUTODISCOVERY_INTERVAL / 4);
+        }
+
+        // Payload is made from the cached strings (base topic, presence payloads), no database access
+        void publishDiscovery(const Device &dev) {
+            // Example
+            // mosquitto_pub -h 127.0.0.1 -t home-assistant/device_tracker/a4567d663eaf/config -m '{"state_topic": "a4567d663eaf/state", "name": "My Tracker", "payload_home": "home", "payload_not_home": "not_home"}'
+            char mac[KEY_STRING_LENGTH + 1];
+            formatKey(dev.mac, mac);
+            char payload[HA_DISCOVERY_PAYLOAD_LENGTH];
+            snprintf(payload, sizeof(payload), "{\"state_topic\": \"%s/%s\", \"name\": \"%s\", \"unique_id\": \"%s\", \"payload_home\": \"%s\", \"payload_not_home\": \"%s\", \"source_type\": \"bluetooth_le\"}",
+                mqttBaseTopic.c_str(), mac, mac, mac, presenceStrings.presentJson.c_str(), presenceStrings.notPresentJson.c_str());
+            mqttMessageSend->fire(MQTTMessage{autoDiscoveryPrefix + "/device_tracker/" + mac + "/config", payload, false, true});
+            discoveryMessages++;
+        }
+
+        // Smoothed RSSI if the filter has a value
+        int reportedRssi(const Device &dev) {
+            return dev.filterReady ? dev.rssiFiltered / 16 : dev.rssi;
+        }
+
+        // One document: the changes since the last one and the RSSI of the available devices
+        void publishSnapshot() {
+            snapshot.begin(lastCycle, presenceStrings.presentJson.c_str(), presenceStrings.notPresentJson.c_str());
+            for (int i = 0; i < presence.size(); i++) {
+                Device &dev = presence.get(i);
+                if (dev.available) {
+                    snapshot.addDevice(dev.mac, reportedRssi(dev));
                 }
             }
+            mqttMessageSend->fire(MQTTMessage{batchTopic, snapshot.finish(), false, batchIndividualTopic});
+        }
 
-            if (!monitorObservedOnly) {
-                if (newFound) {
-                    Device dev = {deviceName, deviceRSSI, deviceMac, true, millis(), DEVICE_DROP_OUT_COUNT, false };
-                    devices.add(dev);
-                    logger << "New device found. MAC: " << deviceMac;
-                    // Send an MQTT message about this device is at home
-                    handleDeviceChange(dev);
+        // RSSI of the available devices (format: 317234b9d2d0:-67,15172f81accc:-80), see fusion.cpp
+        void publishRssiSummary() {
+            char payload[FUSION_MAX_PAYLOAD + 1];
+            size_t length = 0;
+            for (int i = 0; i < presence.size(); i++) {
+                Device &dev = presence.get(i);
+                if (!dev.available) {
+                    continue;
+                }
+                int rssi = reportedRssi(dev);
+                char mac[KEY_STRING_LENGTH + 1];
+                formatKey(dev.mac, mac);
+                char entry[KEY_STRING_LENGTH + 8];
+                int entryLength = snprintf(entry, sizeof(entry), (length > 0) ? ",%s:%d" : "%s:%d", mac, rssi);
+                if (length + entryLength > FUSION_MAX_PAYLOAD) {
+                    mqttMessageSend->fire(MQTTMessage{rssiSummaryTopic, payload, false, true});
+                    length = 0;
+                    entryLength = snprintf(entry, sizeof(entry), "%s:%d", mac, rssi);
                 }
+                memcpy(payload + length, entry, entryLength + 1);
+                length += entryLength;
+            }
+            if (length > 0) {
+                mqttMessageSend->fire(MQTTMessage{rssiSummaryTopic, payload, false, true});
+            }
+        }
+
+        // RSSI filter, hysteresis and dwell time. Everything is off by default, the original behaviour.
+        void configurePresence() {
+            PresenceConfig config;
+
+            int smoothing = database -> getValueAsInt(DB_RSSI_SMOOTHING);
+            if (smoothing > 0 && smoothing <= 100) {
+                config.rssiSmoothing = smoothing;
+            }
+            config.enterRssi = readRssiThreshold(DB_RSSI_ENTER);
+            config.exitRssi = readRssiThreshold(DB_RSSI_EXIT);
+            config.beaconIdentity = database -> getValueAsInt(DB_BEACON_IDENTITY) > 0;
+            int dwell = database -> getValueAsInt(DB_MIN_DWELL);
+            if (dwell > 0) {
+                config.minDwell = (uint32_t) dwell * 1000;
+            }
+
+            // Departure timeout learned per device
+            int confidence = database -> getValueAsInt(DB_TIMEOUT_CONFIDENCE);
+            if (confidence > 0 && confidence < 100) {
+                config.confidence = confidence;
+            }
+            int timeoutFloor = database -> getValueAsInt(DB_TIMEOUT_FLOOR);
+            if (timeoutFloor > 0) {
+                config.timeoutFloor = (uint32_t) timeoutFloor * 1000;
+            }
+            int timeoutCeiling = database -> getValueAsInt(DB_TIMEOUT_CEILING);
+            if (timeoutCeiling > 0) {
+                config.timeoutCeiling = (uint32_t) timeoutCeiling * 1000;
+            }
+
+            presence.configure(config);
+
+            if (config.enterRssi != RSSI_FILTER_OFF || config.rssiSmoothing != 100 || config.minDwell > 0) {
+                logger << "RSSI filter: smoothing " << (String)config.rssiSmoothing << "% enter " << (String)config.enterRssi << " dBm exit " << (String)config.exitRssi << " dBm dwell " << (String)(config.minDwell / 1000) << " s";
+            }
+            if (config.confidence > 0) {
+                logger << "Adaptive timeout: confidence " << (String)config.confidence << "% between " << (String)(config.timeoutFloor / 1000) << " s and " << (String)(config.timeoutCeiling / 1000) << " s";
             }
         }
 
-        void fillDevices(String devicesString) {
-
-            if (devicesString.length() == 0) { return; }
-
-            this->monitorObservedOnly = true;
-            char *devicesChar = new char[devicesString.length() + 1];
-            strcpy(devicesChar, devicesString.c_str());
-            String devMac = "";
-            while ((devMac = strtok_r(devicesChar, PARSE_CHAR, &devicesChar)) != NULL) { // delimiter is the semicolon
-                if (devMac.length() > 0) {
-                    devMac.toLowerCase();
-                    Device device = {
-                       "", // name
-                       "", // rssi
-                       devMac, // mac
-                       false, // available
-                       millis(), // lastSeen
-                       DEVICE_DROP_OUT_COUNT, // mark
-                       true //observed
-                    };
-                    this -> devices.add(device);
-                    logger << "Device added as observed device. MAC: " << devMac;
+        // Device table limit: from the database or derived from the free heap
+        void configureCapacity() {
+            int capacity = database -> getValueAsInt(DB_MAX_DEVICES);
+            if (capacity <= 0) {
+                capacity = ESP.getFreeHeap() / BT_DEVICE_HEAP_SHARE / DeviceTable::ENTRY_SIZE;
+                capacity = (capacity < BT_MIN_DEVICES) ? BT_MIN_DEVICES : capacity;
+                capacity = (capacity > BT_MAX_DEVICES) ? BT_MAX_DEVICES : capacity;
+            }
+            presence.setCapacity(capacity);
+            scanner -> setCapacity(capacity);
+            logger << "Device table limit: " << (String)capacity << " Free heap: " << (String)ESP.getFreeHeap();
+        }
+
+        // Threshold in dBm, "85" is taken as -85 (web form validator accepts positive numbers only)
+        int8_t readRssiThreshold(const char* property) {
+            if (database -> getValueAsString(property).length() == 0) {
+                return RSSI_FILTER_OFF;
+            }
+            int rssi = database -> getValueAsInt(property);
+            if (rssi > 0) {
+                rssi = -rssi;
+            }
+            if (rssi == 0 || rssi < RSSI_FILTER_OFF) {
+                return RSSI_FILTER_OFF;
+            }
+            return rssi;
+        }
+
+        // Reconcile the device table with the observed device list (parsed and stored by the database)
+        void fillDevices() {
+
+            std::vector<uint64_t> keys = database -> getObservedDevices();
+            // Only the observed device list switches to observed only mode
+            boolean observedOnly = !keys.empty();
+
+            // Devices with an Identity Resolving Key are observed too (prefilled, never evicted)
+            std::vector<IdentityResolvingKey> irks = parseIdentityResolvingKeys(database -> getValueAsString(DB_IRKS));
+            for (size_t i = 0; i < irks.size(); i++) {
+                keys.push_back(irks[i].key);
+            }
+
+            int added = presence.setObserved(keys, millis(), observedOnly);
+            if (added > 0) {
+                logger << "Devices added as observed device: " << (String)added;
+                startDiscovery(0);
+            }
+
+            // Foreign devices are dropped already in the BLE callback (observed only mode)
+            scanner -> setIdentityResolvingKeys(irks);
+            scanner -> setFilter(observedOnly ? keys : std::vector<uint64_t>());
+        }
+
+        // Format: <device>=<IRK as 32 hex digits>;<device>=<IRK> e.g. 317234b9d2d0=ec0234a357c8ad05341010a60a397d9b
+        std::vector<IdentityResolvingKey> parseIdentityResolvingKeys(String irksString) {
+            std::vector<IdentityResolvingKey> irks;
+            if (irksString.length() == 0) {
+                return irks;
+            }
+
+            char *irksBuffer = new char[irksString.length() + 1];
+            char *irksChar = irksBuffer; // strtok_r moves this pointer
+            strcpy(irksChar, irksString.c_str());
+            char *entry;
+            while ((entry = strtok_r(irksChar, PARSE_CHAR, &irksChar)) != NULL) {
+                IdentityResolvingKey irk;
+                if (parseIdentityResolvingKey(entry, irk)) {
+                    irks.push_back(irk);
+                    continue;
                 }
+                // Do not log the key itself
+                logger << "Invalid entry in the Identity Resolving Key list: " << entry;
             }
 
-            delete [] devicesChar;
+            delete [] irksBuffer;
+            return irks;
         }
 
-        void handleDeviceChange(Device dev) {
-            mqttMessageSend->fire(MQTTMessage{dev.mac, getPresentString(*database, dev.available), true});
+        void handleDeviceChange(const Device &dev) {
+            if (batchMode != BATCH_MODE_OFF) {
+                if (!snapshot.addChange(dev.mac, dev.available)) {
+                    // Too many changes in this cycle
+                    publishSnapshot();
+                }
+                if (batchMode == BATCH_MODE_ONLY) {
+                    deviceChanged->fire(dev);
+                    return;
+                }
+            }
+
+            // Plain data, the topic and the payload are written by the MQTT client from its buffers
+            // Arrival: BLE callback -> state change, departure: last advertisement -> state change (the timeout)
+            // In 64 bit: a prefilled device can be unseen for longer than what fits in microseconds (~71 minutes),
+            // it goes to the last histogram bucket
+            uint64_t detectionLatency = (uint64_t) (millis() - dev.lastSeen) * 1000;
+            stateMessageSend->fire(StateMessage{dev.mac, dev.available, (uint8_t) (dev.available ? LATENCY_ARRIVAL : LATENCY_DEPARTURE),
+                (uint32_t) micros(), (detectionLatency > UINT32_MAX) ? UINT32_MAX : (uint32_t) detectionLatency});
             // TODO: need to refactor, send only one message for the consumers
             deviceChanged->fire(dev);
 
             if (detailedReport) {
-                String payload = "{\"name\":\"" + ((dev.name == NULL) ? "" : dev.name) + "\", \"rssi\":\"" + ((dev.rssi == NULL) ? "" : dev.rssi) + "\", \"mac\":\"" + ((dev.mac == NULL) ? "" : dev.mac) + "\", \"presence\":\"" + getPresentString(*database, dev.available) + "\", \"observed\":\"" + ((dev.observed) ? "true" : "false") + "\"}";
-                mqttMessageSend->fire(MQTTMessage{"status/" + dev.mac, payload, false});
+                // Text formats are made here, at the edge, in stack buffers
+                const String &state = presenceStrings.getJson(dev.available);
+                char name[JSON_ESCAPED_LENGTH(DEVICE_NAME_LENGTH) + 1];
+                jsonEscape(dev.name, name, sizeof(name));
+                char mac[KEY_STRING_LENGTH + 1];
+                formatKey(dev.mac, mac);
+                char topic[KEY_STRING_LENGTH + 8];
+                snprintf(topic, sizeof(topic), "status/%s", mac);
+                char payload[DETAILED_REPORT_LENGTH];
+                snprintf(payload, sizeof(payload), "{\"name\":\"%s\", \"rssi\":\"%d\", \"mac\":\"%s\", \"presence\":\"%s\", \"observed\":\"%s\"}",
+                    name, dev.rssi, mac, state.c_str(), (dev.observed) ? "true" : "false");
+                mqttMessageSend->fire(MQTTMessage{topic, payload, false});
             }
         }
 };
@@ -0,0 +1,22 @@
+#ifndef CONFIG
+#define CONFIG
+
+#include <Arduino.h>
+#include "definitions.h"
+
+// Typed snapshot of the settings which are read on the hot paths (per message, per state change).
+// It is built from the JSON data after every load and save, see Database::rebuildConfig(). The other settings are
+// read once at setup by their owners.
+struct Config {
+    uint32_t version = 0;                           // incremented by every rebuild, a changed version means changed settings
+    char present[CONFIG_STRING_LENGTH + 1];         // presence payloads, the defaults are applied
+    char notPresent[CONFIG_STRING_LENGTH + 1];
+    char webhook[CONFIG_URL_LENGTH + 1];            // empty: no webhook
+
+    // Truncated if it is too long
+    static void copy(char* target, size_t size, const String &value) {
+        snprintf(target, size, "%s", value.c_str());
+    }
+};
+
+#endif
@@ -5,6 +5,11 @@
 // data
 
 #include "definitions.h"
+#include "config.cpp"
+#include "nvsstore.cpp"
+#include "adparser.cpp"
+#include <vector>
+#include <atomic>
 #include <EEPROM.h>
 #include <ArduinoJson.h> // version 6
 #include "log.hpp"
@@ -12,21 +17,34 @@
 class Database {
 
     Logger logger;
-    StaticJsonDocument<1000> jsonData;    
+    // Sized from the number of the setting keys (DB_JSON_SIZE). Replaced values are not freed in the document,
+    // they are freed by garbageCollect() when it is full.
+    DynamicJsonDocument jsonData;
+    NvsStore store;
+    // Observed devices: packed binary in the store (see packDevices()), not in the JSON data, so the length of
+    // the list is not limited by the size of the JSON document. The JSON APIs see it as the "devices" string.
+    std::vector<uint64_t> observed;
+
+    // Typed settings: double buffered, the new one is built in the inactive slot and switched in one step
+    Config configs[2];
+    std::atomic<uint8_t> activeConfig;
 
     public: 
-        Database(Log& rlog) : logger(rlog, "[STORE]") {
+        Database(Log& rlog) : logger(rlog, "[STORE]"), jsonData(DB_JSON_SIZE), activeConfig(0) {
+            rebuildConfig();
         }
 
         void setup() {
-            EEPROM.begin(EEPROM_SIZE);
+            if (!store.begin()) {
+                migrate();
+            }
             this->init();
         }
 
         void loop() {
         }
 
-        // Init EEPROM to check/set the identification
+        // Init the store to check/set the identification
         void init() {
             String name = this -> getValueAsString("name", true);
 
@@ -35,54 +53,69 @@ class Database {
             } else {
                 logger << "Board name was not found, reinit the database.";
                 jsonData.clear();
+                store.clear();
                 this->updateProperty("name", BOARD_NAME, true);
             }
         }
 
         // Read all from the store
         void load() {
-            String data = EEPROM.readString(0);
-            logger << "data loaded: " << data;
-            DeserializationError error = deserializeJson(jsonData, data);
-
-            if (error) {
-                logger << "DeserializationError: " << error.c_str();
-                jsonData.clear();          
+            jsonData.clear();
+            if (!store.readAll(jsonData)) {
+                logger << "ERROR: stored settings do not fit in the JSON document (" << (String)DB_JSON_SIZE << " bytes), some of them are not loaded";
+            }
+            if (jsonData.containsKey(DB_DEVICES)) {
+                // Earlier versions stored the list as a string in the JSON data
+                String devices = jsonData[DB_DEVICES].as<String>();
+                jsonData.remove(DB_DEVICES);
+                store.remove(DB_DEVICES);
+                setObservedDevices(devices.c_str());
             } else {
-                logger << "Data successfully parsed";
+                loadObservedDevices();
             }
+            logger << "data loaded: " << getSerialized();
+            rebuildConfig();
         }
 
-        // Always rewrite all data
-        // Use it carefully
+        // Only the changed values are written
         void save() {
+            int written = writeStore();
+            logger << "data saved, changed values: " << (String)written;
+            rebuildConfig();
+        }
 
-            String data = "";
-            serializeJson(jsonData, data);
-            
-            // Clean the store first
-            reset();
-
-            EEPROM.writeString(0, data);
-            EEPROM.commit();
-            logger << "data saved: " << data;
+        // Typed settings for the hot paths, no key search and no String. The reference is valid till the next
+        // database change, do not keep it across loop() calls.
+        const Config& getConfig() {
+            return configs[activeConfig.load()];
         }
 
-        void updateProperty(String property, String value) {            
-            updateProperty(property, value, false);
+        boolean updateProperty(String property, String value) {            
+            return updateProperty(property, value, false);
         }
 
         // Update a property in a json data strucure.
-        // Save to the store if saveValues is true
-        void updateProperty(String property, String value, boolean saveValues) {            
+        // Save to the store if saveValues is true. Returns false if the document is full, the not saved changes
+        // are dropped then (the stored settings are reloaded).
+        boolean updateProperty(String property, String value, boolean saveValues) {            
             int str_len = property.length() + 1;
             char prop[str_len];
             property.toCharArray(prop, str_len);
 
             this->jsonData[prop] = value;
+            if (jsonData.overflowed()) {
+                jsonData.garbageCollect();
+                this->jsonData[prop] = value;
+            }
+            if (jsonData.overflowed()) {
+                logger << "ERROR: settings do not fit in the JSON document (" << (String)DB_JSON_SIZE << " bytes), " << property << " is not set";
+                load();
+                return false;
+            }
             if (saveValues) {
                 save();             
             }
+            return true;
         }
 
         String getValueAsString(String name) {
@@ -94,6 +127,10 @@ class Database {
                 load();
             }            
 
+            if (name == DB_DEVICES) {
+                return getObservedDevicesString();
+            }
+
             if (jsonData.containsKey(name)){
                 return jsonData[name.c_str()].as<String>();
             } else {
@@ -143,50 +180,65 @@ class Database {
         String getSerialized() {
             String output;
             serializeJson(jsonData, output);
+            if (!observed.empty()) {
+                // The device list is not in the JSON data
+                output.remove(output.length() - 1);
+                output += (output.length() > 1) ? ",\"" : "\"";
+                output += DB_DEVICES;
+                output += "\":\"";
+                output += getObservedDevicesString();
+                output += "\"}";
+            }
             return output;
         }
 
+        // Parsed observed device keys (MAC addresses and beacon identity keys), see parseDeviceId()
+        const std::vector<uint64_t>& getObservedDevices() {
+            return observed;
+        }
+
+        // Format of the web interface and the MQTT config command (keys separated by ";")
+        String getObservedDevicesString() {
+            String devices = "";
+            devices.reserve(observed.size() * (KEY_STRING_LENGTH + 1));
+            for (size_t i = 0; i < observed.size(); i++) {
+                char key[KEY_STRING_LENGTH + 1];
+                formatKey(observed[i], key);
+                if (i > 0) {
+                    devices += PARSE_CHAR;
+                }
+                devices += key;
+            }
+            return devices;
+        }
+
         void jsonToDatabase(String json) {
             
-            StaticJsonDocument<1000> tempJson; 
-            DeserializationError error = deserializeJson(tempJson, json);
+            logger << "jsonToDatabase process. Data: " << json;
+            // Parsed in place (zero-copy), the strings (e.g. a long device list) do not use the document
+            DynamicJsonDocument tempJson(DB_COMMAND_JSON_SIZE);
+            DeserializationError error = deserializeJson(tempJson, json.begin());
 
             if (error) {
-                logger << "DeserializationError: " << error.c_str() << " (jsonToDatabase) " << json;
+                logger << "DeserializationError: " << error.c_str() << " (jsonToDatabase)";
             } else {
-                logger << "Data successfully parsed during jsonToDatabase process. Data: " << json;
-                // Save mechanism from hackers
-                // Data alaways have a name property, because the system initialize the EEPROM if the format is not correct.
-                // See the init() function
-                // Check the if name is available and it is the same az a board name. In case of matching, save the data
-                String value = tempJson["name"].as<String>();
-                
-                if (String(BOARD_NAME).equals(value)) {
-                    // update/add properties individually, overwrite the wole database remove some other properties from other settings source (MQTT ledstrip)
-                    JsonObject documentRoot = tempJson.as<JsonObject>();
-                    for (JsonPair keyValue : documentRoot) {
-                        if (strcmp(keyValue.key().c_str(),"command") != 0)
-                        this -> updateProperty(keyValue.key().c_str(), keyValue.value().as<String>());
-                    }
-                    save();
-                } else {
-                    logger << "Json data is not valid, database was not overwritten.";
-                }
-                
+                logger << "Data successfully parsed during jsonToDatabase process.";
+                storeJson(tempJson);
             }
         }
 
-        void receiveCommand(String message) {
-            StaticJsonDocument<1000> tempJson; 
+        // MQTT command, the message is parsed in place (zero-copy, the buffer is modified)
+        void receiveCommand(char* message) {
+            DynamicJsonDocument tempJson(DB_COMMAND_JSON_SIZE);
             DeserializationError error = deserializeJson(tempJson, message);
 
             if (error) {
-                logger << "DeserializationError: " << error.c_str() << " (receiveCommand) " << message;
+                logger << "DeserializationError: " << error.c_str() << " (receiveCommand)";
             } else {               
-                String value = tempJson["command"].as<String>();                
-                if (String(COMMAND_CONFIG).equals(value)) {
+                const char* value = tempJson["command"];
+                if (value != NULL && strcmp(value, COMMAND_CONFIG) == 0) {
                     logger << "Command received: " << COMMAND_CONFIG;
-                    this -> jsonToDatabase(message);
+                    this -> storeJson(tempJson);
                 }
                 
             }
@@ -194,13 +246,189 @@ class Database {
 
         void reset(){
             // Reset settings
-            logger << "Clear EEPROM";
-            for (int i = 0; i < EEPROM_SIZE; ++i) { EEPROM.write(i, 0); }
-            EEPROM.commit();
-            logger << "EEPROM is clean.";
+            logger << "Clear the store";
+            store.clear();
+            logger << "Store is clean.";
+        }
+
+        void fillStats(JsonObject stats) {
+            JsonObject storeStats = stats.createNestedObject("store");
+            store.fillStats(storeStats);
+            storeStats["document_usage"] = jsonData.memoryUsage();
+            storeStats["document_size"] = jsonData.capacity();
         }
 
     private:
+        // Device list in the text format (317234b9d2d0;15172f81accc;ibeacon:<uuid>:<major>:<minor>), see parseDeviceId()
+        void setObservedDevices(const char* text) {
+            std::vector<uint64_t> keys;
+            if (text != NULL && text[0] != '\0') {
+                char *devicesBuffer = new char[strlen(text) + 1];
+                char *devicesChar = devicesBuffer; // strtok_r moves this pointer
+                strcpy(devicesChar, text);
+                char *device;
+                while ((device = strtok_r(devicesChar, PARSE_CHAR, &devicesChar)) != NULL) { // delimiter is the semicolon
+                    uint64_t key;
+                    if (parseDeviceId(device, key)) {
+                        keys.push_back(key);
+                        if (isIdentityKey(key) && strlen(device) != KEY_STRING_LENGTH) {
+                            logger << "Beacon " << device << " is reported as " << keyToMac(key);
+                        }
+                    } else {
+                        logger << "Invalid device in the observed device list: " << device;
+                    }
+                }
+                delete [] devicesBuffer;
+            }
+
+            if (keys == observed && store.blobLength(STORE_DEVICES_KEY) > 0) {
+                return;
+            }
+            observed = keys;
+            std::vector<uint8_t> packed = packDevices(observed);
+            store.writeBlob(STORE_DEVICES_KEY, packed.data(), packed.size());
+            logger << "Observed devices: " << (String)observed.size() << " stored in " << (String)packed.size() << " bytes";
+        }
+
+        // One read, no text parsing
+        void loadObservedDevices() {
+            observed.clear();
+            size_t length = store.blobLength(STORE_DEVICES_KEY);
+            if (length == 0) {
+                return;
+            }
+            std::vector<uint8_t> packed(length);
+            store.readBlob(STORE_DEVICES_KEY, packed.data(), length);
+            if (!unpackDevices(packed, observed)) {
+                logger << "Observed device list is corrupt, it is ignored";
+                observed.clear();
+            }
+        }
+
+        // Packed format: version (1 byte), number of the MAC addresses (2 bytes), number of the identity keys (2 bytes),
+        // 6 bytes per MAC address, then 8 bytes per beacon identity key (most significant byte first)
+        static std::vector<uint8_t> packDevices(const std::vector<uint64_t> &keys) {
+            uint16_t macs = 0;
+            for (size_t i = 0; i < keys.size(); i++) {
+                macs += isIdentityKey(keys[i]) ? 0 : 1;
+            }
+            uint16_t identities = keys.size() - macs;
+
+            std::vector<uint8_t> packed;
+            packed.reserve(5 + macs * 6 + identities * 8);
+            packed.push_back(STORE_DEVICES_VERSION);
+            packed.push_back(macs >> 8);
+            packed.push_back(macs & 0xFF);
+            packed.push_back(identities >> 8);
+            packed.push_back(identities & 0xFF);
+            for (int pass = 0; pass < 2; pass++) {
+                for (size_t i = 0; i < keys.size(); i++) {
+                    if (isIdentityKey(keys[i]) != (pass == 1)) {
+                        continue;
+                    }
+                    for (int shift = (pass == 0) ? 40 : 56; shift >= 0; shift -= 8) {
+                        packed.push_back((keys[i] >> shift) & 0xFF);
+                    }
+                }
+            }
+            return packed;
+        }
+
+        static boolean unpackDevices(const std::vector<uint8_t> &packed, std::vector<uint64_t> &keys) {
+            if (packed.size() < 5 || packed[0] != STORE_DEVICES_VERSION) {
+                return false;
+            }
+            size_t macs = (packed[1] << 8) | packed[2];
+            size_t identities = (packed[3] << 8) | packed[4];
+            if (packed.size() != 5 + macs * 6 + identities * 8) {
+                return false;
+            }
+            keys.reserve(macs + identities);
+            size_t position = 5;
+            for (size_t i = 0; i < macs + identities; i++) {
+                size_t length = (i < macs) ? 6 : 8;
+                uint64_t key = 0;
+                for (size_t j = 0; j < length; j++) {
+                    key = (key << 8) | packed[position++];
+                }
+                keys.push_back(key);
+            }
+            return true;
+        }
+
+        // Settings of the earlier versions (JSON string in the EEPROM), they are copied into the store once.
+        // The EEPROM is not cleared, an older firmware still finds its settings.
+        void migrate() {
+            EEPROM.begin(EEPROM_SIZE);
+            String data = EEPROM.readString(0);
+            EEPROM.end();
+
+            DeserializationError error = deserializeJson(jsonData, data);
+            if (error || !String(BOARD_NAME).equals(jsonData["name"].as<String>())) {
+                logger << "No settings to migrate from the EEPROM";
+                jsonData.clear();
+                return;
+            }
+            int written = writeStore();
+            logger << "Settings are migrated from the EEPROM: " << (String)written;
+        }
+
+        int writeStore() {
+            String rejected;
+            int written = store.write(jsonData, rejected);
+            if (rejected.length() > 0) {
+                logger << "ERROR: keys longer than " << (String)STORE_KEY_LENGTH << " characters are not stored: " << rejected;
+            }
+            return written;
+        }
+
+        void rebuildConfig() {
+            uint8_t next = activeConfig.load() ^ 1;
+            Config &config = configs[next];
+
+            String present = getValueAsString(DB_PRECENCE);
+            Config::copy(config.present, sizeof(config.present), (present.length() > 0) ? present : String(DEFAULT_PRESENT));
+            String notPresent = getValueAsString(DB_NO_PRECENCE);
+            Config::copy(config.notPresent, sizeof(config.notPresent), (notPresent.length() > 0) ? notPresent : String(DEFAULT_NOT_PRESENT));
+            Config::copy(config.webhook, sizeof(config.webhook), getValueAsString(DB_WEBHOOK));
+            config.version = configs[activeConfig.load()].version + 1;
+
+            activeConfig.store(next);
+        }
+
+        void storeJson(JsonDocument &tempJson) {
+            // Save mechanism from hackers
+            // Data alaways have a name property, because the system initialize the EEPROM if the format is not correct.
+            // See the init() function
+            // Check the if name is available and it is the same az a board name. In case of matching, save the data
+            String value = tempJson["name"].as<String>();
+            
+            if (String(BOARD_NAME).equals(value)) {
+                // update/add properties individually, overwrite the wole database remove some other properties from other settings source (MQTT ledstrip)
+                // The device list is written only when every other property is accepted, a rejected command
+                // leaves both the settings and the observed devices untouched
+                JsonObject documentRoot = tempJson.as<JsonObject>();
+                boolean hasDevices = false;
+                const char* devices = NULL;
+                for (JsonPair keyValue : documentRoot) {
+                    if (strcmp(keyValue.key().c_str(), DB_DEVICES) == 0) {
+                        hasDevices = true;
+                        devices = keyValue.value().as<const char*>();
+                    } else if (strcmp(keyValue.key().c_str(),"command") != 0
+                            && !this -> updateProperty(keyValue.key().c_str(), keyValue.value().as<String>())) {
+                        logger << "Json data does not fit, database was not overwritten.";
+                        return;
+                    }
+                }
+                if (hasDevices) {
+                    setObservedDevices(devices);
+                }
+                save();
+            } else {
+                logger << "Json data is not valid, database was not overwritten.";
+            }
+        }
+
         boolean isNumeric(String str) {
             unsigned int stringLength = str.length();
 
@@ -210,7 +438,10 @@ class Database {
 
             boolean seenDecimal = false;
 
-            for(unsigned int i = 0; i < stringLength; ++i) {
+            // Negative numbers are allowed (e.g. RSSI thresholds)
+            unsigned int start = (str.charAt(0) == '-' && stringLength > 1) ? 1 : 0;
+
+            for(unsigned int i = start; i < stringLength; ++i) {
                 if (isDigit(str.charAt(i))) {
                     continue;
                 }
@@ -228,4 +459,38 @@ class Database {
         }
 };
 
+// Get the name of the presence string. This is not the state, just the name which will be sent over!!!
+static const char* getPresentString (Database &database, boolean presenceState) {
+    const Config &config = database.getConfig();
+    return presenceState ? config.present : config.notPresent;
+}
+
+// The two presence payloads as Strings (the payload of the MQTT messages), copied once per config change (not per message)
+struct PresenceStrings {
+    String present = DEFAULT_PRESENT;
+    String notPresent = DEFAULT_NOT_PRESENT;
+    String presentJson = DEFAULT_PRESENT;   // escaped for the JSON documents (snapshot, discovery, detailed report)
+    String notPresentJson = DEFAULT_NOT_PRESENT;
+    uint32_t version = 0;                   // of the config
+
+    void load(Database &database) {
+        present = getPresentString(database, true);
+        notPresent = getPresentString(database, false);
+        char escaped[JSON_ESCAPED_LENGTH(CONFIG_STRING_LENGTH) + 1];
+        jsonEscape(present.c_str(), escaped, sizeof(escaped));
+        presentJson = escaped;
+        jsonEscape(notPresent.c_str(), escaped, sizeof(escaped));
+        notPresentJson = escaped;
+        version = database.getConfig().version;
+    }
+
+    const String& get(boolean presenceState) const {
+        return presenceState ? present : notPresent;
+    }
+
+    const String& getJson(boolean presenceState) const {
+        return presenceState ? presentJson : notPresentJson;
+    }
+};
+
 #endif
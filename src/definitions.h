@@ -4,13 +4,35 @@
 // Board specific setings
 #define BOARD_NAME "blecker"
 #define LED_BUILTIN 2
-#define EEPROM_SIZE 1024
+#define EEPROM_SIZE 1024 // Settings store of the earlier versions, read once for the migration
+#define STORE_NAMESPACE "blecker" // NVS namespace of the settings
+#define STORE_INDEX_KEY "_keys" // List of the stored keys
+#define STORE_KEY_LENGTH 15 // NVS key limit
+#define STORE_ENTRY_SIZE 32 // NVS entry size (write statistics)
+#define STORE_DEVICES_KEY "devicelist" // Packed observed device list (not in the JSON data)
+#define STORE_DEVICES_VERSION 1
+#define DB_KEY_COUNT 48 // Settings keys the JSON document is sized for (40 are used now)
+#define DB_VALUES_SIZE 2048 // Keys and values of the settings together, they are copied into the document
+#define DB_JSON_SIZE (JSON_OBJECT_SIZE(DB_KEY_COUNT) + DB_VALUES_SIZE) // Settings document (heap)
+#define DB_COMMAND_JSON_SIZE JSON_OBJECT_SIZE(DB_KEY_COUNT + 1) // Config command/web form, parsed in place: the slots only
 
 // Software settings
 #define SERVER_PORT 80
-#define MQTT_MAX_TRY 10 // give the connect up after this amount of tries
+#define STATS_JSON_SIZE 4096 // JSON document size of the /stats response
+#define MQTT_BACKOFF_MIN 1000 // Wait after the first failed connect (ms), it is doubled after every failure
+#define MQTT_BACKOFF_MAX 1000*60 // Longest wait between two connect tries, the broker address is resolved again after it
+#define MQTT_SOCKET_TIMEOUT 2 // TCP connect / read / write timeout in seconds (the loop is blocked for this time at most)
+#define MQTT_CONNACK_TIMEOUT 2000 // Wait for the broker's answer (ms)
+#define MQTT_DEFAULT_PORT 1883
 #define MQTT_TOPIC "/blecker"
 #define MQTT_IN_POSTFIX "/in"
+#define MQTT_QUEUE_SIZE 32 // Outbound messages waiting for the connection besides the device states (one per device of the device table)
+#define MQTT_DEFAULT_SEND_RATE 20 // Outbound messages per second
+#define MQTT_OBSERVED_DEVICES 256 // Observed devices (MAC addresses) a config command can carry, the inbound buffer is sized for it
+#define OBSERVED_DEVICE_TEXT_LENGTH 13 // One MAC address and the separator in the device list
+#define MQTT_INBOUND_SIZE (DB_VALUES_SIZE + MQTT_OBSERVED_DEVICES * OBSERVED_DEVICE_TEXT_LENGTH) // Longest accepted incoming payload, longer messages are dropped (counted on /stats)
+#define MQTT_TOPIC_LENGTH 128 // Full topics are built in a buffer of this size (longer ones in a String)
+#define DETAILED_REPORT_LENGTH 192 // Detailed report JSON of a device (status/<mac>)
 
 #define MQTT_STATUS_ON_DEFAULT_VALUE "on"
 #define MQTT_STATUS_OFF_DEFAULT_VALUE "off"
@@ -19,19 +41,85 @@
 // Presence
 #define DEFAULT_PRESENT "present"
 #define DEFAULT_NOT_PRESENT "not_present"
+#define CONFIG_STRING_LENGTH 63 // Presence strings are truncated to this length
+#define CONFIG_URL_LENGTH 255 // Webhook URL
 #define BT_DEVICE_TIMEOUT 1000*60 // 60 seconds in milliseconds (it is doubled because of the mark mechanism) // After this time we sent a "not_home" mqtt message
-#define BT_LIST_REBUILD_INTERVAL 1000*60*60 // Just clear the list after every hour and rebuild again, send "refresh" state time to time even if the device is not gone
+#define BT_LIST_REBUILD_INTERVAL 1000*60*60 // Every device state is resent once in this interval (one by one, spread evenly), the observed list is reconciled
+#define BT_DEVICE_STALE_TIMEOUT 1000*60*60 // Not available, not observed device is removed from the table after this time
 #define BT_DEVICE_DATA_INTERVAL 1000*60 // Send the BLE device data time to time
 #define DEVICE_DROP_OUT_COUNT 2 // We won't drop out in the first "not found" state, just decrease this value. Drop out when this is 0
+#define BT_TIMER_WHEEL_SLOTS 256 // Device deadline timer wheel size, deadlines further than SLOTS * RESOLUTION go around
+#define BT_TIMER_WHEEL_RESOLUTION 250 // Device deadline timer wheel resolution in milliseconds
 #define PARSE_CHAR ";"
-#define BT_DEFAULT_SCAN_INTERVAL 2000 // Scan is running after this timeout time to time
+#define DEVICE_NAME_LENGTH 20 // Advertised device name is truncated to this length
+#define BT_DEFAULT_SCAN_INTERVAL 2000 // Minimum time between two scan window starts
+#define BT_ADVERTISEMENT_QUEUE_SIZE 64 // BLE task -> loop() queue size, must be a power of two. See queue_high_water_mark on /stats
+#define BLE_PAYLOAD_LENGTH 62 // Advertisement + scan response data
+#define BT_SCAN_DURATION 5 // Length of one background scan window in seconds, BLE library result cache is cleared after every window
+#define BT_DEVICE_HEAP_SHARE 4 // Default device table limit: this part (1/4) of the free heap at boot can be used by the devices
+#define BT_MIN_DEVICES 32 // Default device table limit is not smaller than this
+#define BT_MAX_DEVICES 2048 // Default device table limit is not bigger than this
+#define RPA_CACHE_MIN_SIZE 32 // Resolved (or not resolvable) private address cache size, sized from the device table limit between MIN and MAX
+#define RPA_CACHE_MAX_SIZE 512 // One entry is 16 bytes, must be a power of two like RPA_CACHE_MIN_SIZE
+#define RPA_CACHE_WAYS 4 // Entries of one cache set, an address can be cached only in its own set
+#define BT_ADAPTIVE_TIMEOUT_FLOOR 1000*10 // Default minimum of the learned departure timeout
+#define BT_ADAPTIVE_MIN_SAMPLES 4 // Learned departure timeout is used after this amount of advertising interval samples
+#define BT_ADAPTIVE_PRESENCE_PERIOD 1000*60*60*8 // The timeout confidence is the chance of no false departure during this much presence
+#define BT_ADAPTIVE_MIN_GAP 100 // Receptions closer than this (ms) are not interval samples (advertisement + scan response)
+#define RSSI_FILTER_OFF -128 // Enter / exit RSSI threshold value when it is not configured
+
+// Main loop
+#define LOOP_STATS_INTERVAL 1000*60 // Log the worst loop() latency time to time
+
+// Presence latency histograms (see histogram.cpp)
+#define LATENCY_BUCKETS 13 // 64 us * 4^i upper bounds: 64 us ... 4.7 min, the last one is unbounded
+#define LATENCY_FIRST_BUCKET 64 // microseconds
+#define LATENCY_PUBLISH_INTERVAL 1000*60*5 // Histograms are published over MQTT (<base topic>/latency)
+#define LATENCY_TOPIC "/latency"
+#define LATENCY_JSON_SIZE 2048
+
+// Multi-node room level presence (see fusion.cpp)
+#define FUSION_MODE_OFF 0
+#define FUSION_MODE_PUBLISH 1 // Publish the RSSI summary of this node
+#define FUSION_MODE_FUSE 2 // Publish the summary and fuse the summaries of all nodes into room level presence
+#define FUSION_DEFAULT_TOPIC "blecker/fusion"
+#define FUSION_NODE_POSTFIX "/node"
+#define FUSION_ROOM_POSTFIX "/room"
+#define FUSION_PUBLISH_INTERVAL 1000*5 // RSSI summary of the node
+#define FUSION_EVALUATE_INTERVAL 1000*5
+#define FUSION_STALE_TIMEOUT 1000*30 // Room reading is ignored after this time (the node does not see the device any more)
+#define FUSION_HYSTERESIS 5 // dB, device moves to another room only if it is stronger there by this
+#define FUSION_MAX_ROOMS 8
+#define FUSION_MAX_PAYLOAD 1024 // Longer RSSI summaries are split
+
+// Batch publishing, see snapshot.cpp
+#define BATCH_MODE_OFF 0 // One message per device (default)
+#define BATCH_MODE_BOTH 1 // Snapshot document and the per device topics
+#define BATCH_MODE_ONLY 2 // Snapshot document only
+#define BATCH_DEFAULT_TOPIC "snapshot" // Under the base topic
+#define BATCH_MAX_CHANGES 64 // The document is published earlier if there are more changes in a scan cycle
+#define BATCH_MAX_PAYLOAD 4096 // Devices which do not fit are left out (counted in the document)
+#define BATCH_CLOSING_LENGTH 40 // Reserved for the closing part of the document
+
+// Advertisement trace (see trace.cpp)
+#define TRACE_FORMAT_VERSION 2
+#define TRACE_BUFFER_SIZE 512
+#define TRACE_FLUSH_INTERVAL 1000
+#define TRACE_RECONNECT_INTERVAL 1000*10
+#define TRACE_CONNECT_TIMEOUT 1000
 
 // Webhook
 #define PRESENCE_WILDCARD "{presence}"
 #define DEVICE_WILDCARD "{device}"
 
 // Auto Discovery
-#define HA_AUTODISCOVERY_INTERVAL 1000*60
+#define HA_AUTODISCOVERY_INTERVAL 1000*60*60*6 // Fallback refresh of the discovery configs (+ random 0..25%)
+#define HA_AUTODISCOVERY_STEP 250 // One discovery config in this time during a full resend (below the MQTT send rate)
+#define HA_BIRTH_JITTER 1000*5 // Full resend starts within this time after the birth message of Home Assistant
+#define HA_DEFAULT_PREFIX "homeassistant"
+#define HA_STATUS_POSTFIX "/status" // Birth and last will topic of Home Assistant under the discovery prefix
+#define HA_STATUS_ONLINE "online"
+#define HA_DISCOVERY_PAYLOAD_LENGTH 384
 
 // Network
 #define WIFI_MAX_TRY 10
@@ -55,6 +143,8 @@
 #define DB_MQTT_USER "mqttuser"
 #define DB_MQTT_PW "mqttpw"
 #define DB_MQTT_TOPIC_PREFIX "mqttprefix"
+#define DB_MQTT_SEND_RATE "mqttrate"
+#define DB_MQTT_KEEPALIVE "mqttkeepalive"
 #define DB_PRECENCE "present"
 #define DB_NO_PRECENCE "notpresent"
 #define DB_VERSION "version"
@@ -68,3 +158,20 @@
 #define DB_DEVICE_STATUS_OFF "status_off"
 #define DB_DEVICE_STATUS_RETAIN "status_retain"
 #define DB_DEVICE_ID "deviceid"
+#define DB_TRACE_HOST "tracehost"
+#define DB_TRACE_PORT "traceport"
+#define DB_RSSI_SMOOTHING "rssialpha"
+#define DB_RSSI_ENTER "rssienter"
+#define DB_RSSI_EXIT "rssiexit"
+#define DB_MIN_DWELL "dwell"
+#define DB_MAX_DEVICES "maxdevices"
+#define DB_BEACON_IDENTITY "beaconid"
+#define DB_IRKS "irks"
+#define DB_TIMEOUT_CONFIDENCE "confidence"
+#define DB_TIMEOUT_FLOOR "timeoutmin"
+#define DB_TIMEOUT_CEILING "timeoutmax"
+#define DB_FUSION_MODE "fusion"
+#define DB_FUSION_TOPIC "fusiontopic"
+#define DB_ROOM "room"
+#define DB_BATCH_MODE "batch"
+#define DB_BATCH_TOPIC "batchtopic"
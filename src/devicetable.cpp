@@ -0,0 +1,224 @@
+#ifndef DEVICETABLE
+#define DEVICETABLE
+
+#include <stdint.h>
+#include <vector>
+#include "utilities.cpp"
+
+// Device storage for the BLE scanner.
+// Devices are kept in a dense array (cheap to iterate, no per node allocation) and an
+// open addressing (linear probing) hash index maps the 48 bit MAC address to the array position.
+// Lookup, insert and remove are O(1) on average, entries are updated in place through the returned pointer.
+// Pointers are valid till the next insert or remove.
+//
+// The table also keeps an intrusive LRU list for the eviction. Only the touch()-ed entries are on the list
+// (the owner decides which entries can be evicted), the links are array positions and they are fixed up on remove().
+class DeviceTable {
+
+    static const int MIN_SLOTS = 16;
+    static const int32_t EMPTY = -1;
+
+    struct LruLink {
+        int32_t newer;
+        int32_t older;
+        bool linked;
+    };
+
+    std::vector<Device> entries;
+    std::vector<uint64_t> keys;     // key of the entry with the same position
+    std::vector<LruLink> links;     // LRU links of the entry with the same position
+    int32_t newest = EMPTY;
+    int32_t oldest = EMPTY;
+    int32_t* slots = NULL;          // position of the entry in the dense array or EMPTY
+    uint32_t slotCount = 0;         // always power of two
+    uint8_t slotBits = 0;
+
+    public:
+        // Approximate memory need of one device (array entries + hash slots at 50% load)
+        static const size_t ENTRY_SIZE = sizeof(Device) + sizeof(uint64_t) + sizeof(LruLink) + 2 * sizeof(int32_t);
+
+        DeviceTable() {
+            allocate(MIN_SLOTS);
+        }
+
+        ~DeviceTable() {
+            delete [] slots;
+        }
+
+        DeviceTable(const DeviceTable&) = delete;
+        DeviceTable& operator = (const DeviceTable&) = delete;
+
+        int size() {
+            return entries.size();
+        }
+
+        // Position based access for iterations, 0 <= index < size()
+        Device& get(int index) {
+            return entries[index];
+        }
+
+        uint64_t keyAt(int index) {
+            return keys[index];
+        }
+
+        Device* find(uint64_t key) {
+            int32_t index = slots[findSlot(key)];
+            return (index == EMPTY) ? NULL : &entries[index];
+        }
+
+        // Add a new device or overwrite the existing one with the same key
+        Device* insert(uint64_t key, const Device& device) {
+            uint32_t slot = findSlot(key);
+            if (slots[slot] != EMPTY) {
+                entries[slots[slot]] = device;
+                return &entries[slots[slot]];
+            }
+
+            // Keep the load factor under 50%, probe sequences stay short
+            if ((entries.size() + 1) * 2 > slotCount) {
+                allocate(slotCount * 2);
+                slot = findSlot(key);
+            }
+
+            slots[slot] = entries.size();
+            entries.push_back(device);
+            keys.push_back(key);
+            links.push_back(LruLink{EMPTY, EMPTY, false});
+            return &entries.back();
+        }
+
+        boolean remove(uint64_t key) {
+            uint32_t slot = findSlot(key);
+            int32_t index = slots[slot];
+            if (index == EMPTY) {
+                return false;
+            }
+
+            unlink(index);
+
+            // Move the last entry to the free position so the array stays dense
+            int32_t last = entries.size() - 1;
+            if (index != last) {
+                slots[findSlot(keys[last])] = index;
+                entries[index] = entries[last];
+                keys[index] = keys[last];
+                moveLink(last, index);
+            }
+            entries.pop_back();
+            keys.pop_back();
+            links.pop_back();
+
+            // Backward shift deletion, no tombstones are needed
+            uint32_t mask = slotCount - 1;
+            uint32_t hole = slot;
+            uint32_t next = (hole + 1) & mask;
+            while (slots[next] != EMPTY) {
+                uint32_t home = hash(keys[slots[next]]);
+                // Move the entry back if its home slot is not between the hole and its current position
+                if (((next - home) & mask) >= ((next - hole) & mask)) {
+                    slots[hole] = slots[next];
+                    hole = next;
+                }
+                next = (next + 1) & mask;
+            }
+            slots[hole] = EMPTY;
+
+            return true;
+        }
+
+        // Device is used, move it to the front of the LRU list (it is added if it is not there)
+        void touch(const Device* device) {
+            int32_t index = device - entries.data();
+            if (newest == index) {
+                return;
+            }
+            unlink(index);
+            links[index] = LruLink{EMPTY, newest, true};
+            if (newest != EMPTY) {
+                links[newest].newer = index;
+            }
+            newest = index;
+            if (oldest == EMPTY) {
+                oldest = index;
+            }
+        }
+
+        // Device is put on the LRU list (as the newest) if it is not there, the order of the list is not changed otherwise
+        void trackIfUnlinked(const Device* device) {
+            if (!links[device - entries.data()].linked) {
+                touch(device);
+            }
+        }
+
+        // Device can not be evicted any more
+        void untrack(const Device* device) {
+            unlink(device - entries.data());
+        }
+
+        // Least recently used device of the LRU list or NULL
+        Device* leastRecent() {
+            return (oldest == EMPTY) ? NULL : &entries[oldest];
+        }
+
+        void clear() {
+            entries.clear();
+            keys.clear();
+            links.clear();
+            newest = EMPTY;
+            oldest = EMPTY;
+            for (uint32_t i = 0; i < slotCount; i++) { slots[i] = EMPTY; }
+        }
+
+    private:
+
+        void unlink(int32_t index) {
+            LruLink &link = links[index];
+            if (!link.linked) {
+                return;
+            }
+            if (link.newer != EMPTY) { links[link.newer].older = link.older; } else { newest = link.older; }
+            if (link.older != EMPTY) { links[link.older].newer = link.newer; } else { oldest = link.newer; }
+            link = LruLink{EMPTY, EMPTY, false};
+        }
+
+        // The entry is moved from the position "from" to "to", the neighbours must point to the new position
+        void moveLink(int32_t from, int32_t to) {
+            LruLink link = links[from];
+            links[to] = link;
+            if (!link.linked) {
+                return;
+            }
+            if (link.newer != EMPTY) { links[link.newer].older = to; } else { newest = to; }
+            if (link.older != EMPTY) { links[link.older].newer = to; } else { oldest = to; }
+        }
+
+        // Fibonacci hashing, the upper bits of the product are well mixed even for sequential MAC addresses
+        uint32_t hash(uint64_t key) {
+            return (uint32_t) ((key * 0x9E3779B97F4A7C15ULL) >> (64 - slotBits));
+        }
+
+        // Slot of the key or the first empty slot of its probe sequence
+        uint32_t findSlot(uint64_t key) {
+            uint32_t mask = slotCount - 1;
+            uint32_t slot = hash(key);
+            while (slots[slot] != EMPTY && keys[slots[slot]] != key) {
+                slot = (slot + 1) & mask;
+            }
+            return slot;
+        }
+
+        void allocate(uint32_t count) {
+            delete [] slots;
+            slots = new int32_t[count];
+            slotCount = count;
+            slotBits = 0;
+            while ((1UL << slotBits) < count) { slotBits++; }
+
+            for (uint32_t i = 0; i < slotCount; i++) { slots[i] = EMPTY; }
+            for (uint32_t i = 0; i < keys.size(); i++) {
+                slots[findSlot(keys[i])] = i;
+            }
+        }
+};
+
+#endif
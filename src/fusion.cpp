@@ -0,0 +1,84 @@
+#ifndef FUSION
+#define FUSION
+
+#include "definitions.h"
+#include "utilities.cpp"
+#include "database.cpp"
+#include "roomfusion.cpp"
+#include "log.hpp"
+#include <Callback.h>
+
+// Room level presence from several blecker nodes (one per room).
+// Every node with fusion enabled publishes the RSSI of its available devices to <fusion topic>/node/<room>
+// (payload: 317234b9d2d0:-67,15172f81accc:-80), see BlueTooth::publishRssiSummary().
+// The node in FUSION_MODE_FUSE mode collects the summaries of all nodes (its own one too, through the broker)
+// and publishes one state per device to <fusion topic>/room/<device>: the name of the room or the not present string.
+// The room assignment itself is in roomfusion.cpp.
+class Fusion : public RoomListener {
+
+    Logger logger;
+    Database* database;
+    Signal<MQTTMessage>* mqttMessageSend;
+
+    boolean enabled = false;
+    String notPresent;          // state of the devices which are not in any room
+    String nodeTopic;           // <fusion topic>/node/
+    String roomTopic;           // <fusion topic>/room/
+    RoomFusion engine;
+    unsigned long lastEvaluate = 0;
+
+    public:
+        Fusion(Log& rlog) : logger(rlog, "[FUSION]") {
+        }
+
+        void setup(Database &database, Signal<MQTTMessage> &mqttMessageSend) {
+            this -> database = &database;
+            this -> mqttMessageSend = &mqttMessageSend;
+
+            this -> enabled = database.getValueAsInt(DB_FUSION_MODE) == FUSION_MODE_FUSE;
+            this -> notPresent = getPresentString(database, false);
+            String topic = getFusionTopic(database);
+            this -> nodeTopic = topic + FUSION_NODE_POSTFIX + "/";
+            this -> roomTopic = topic + FUSION_ROOM_POSTFIX + "/";
+            this -> engine.setup(*this);
+
+            if (enabled) {
+                logger << "Room level presence is published to " << roomTopic;
+            }
+        }
+
+        void loop() {
+            if (enabled && millis() - lastEvaluate > FUSION_EVALUATE_INTERVAL) {
+                lastEvaluate = millis();
+                engine.loop(millis());
+            }
+        }
+
+        // MQTT message on a subscribed topic (not the command topic)
+        void messageArrived(MQTTInboundMessage message) {
+            if (!enabled || strncmp(message.topic, nodeTopic.c_str(), nodeTopic.length()) != 0) {
+                return;
+            }
+
+            const char* room = message.topic + nodeTopic.length();
+            if (engine.summaryArrived(room, message.payload, millis())) {
+                logger << "New room: " << room;
+            }
+        }
+
+        void roomChanged(uint64_t key, const char* room) override {
+            char mac[KEY_STRING_LENGTH + 1];
+            formatKey(key, mac);
+            MQTTMessage message = MQTTMessage{roomTopic + mac, (room == NULL) ? notPresent : String(room), true, true};
+            message.coalesce = true;
+            mqttMessageSend->fire(message);
+        }
+
+        // Shared by the publishers and the fusion node
+        static String getFusionTopic(Database &database) {
+            String topic = database.getValueAsString(DB_FUSION_TOPIC);
+            return (topic.length() > 0) ? topic : String(FUSION_DEFAULT_TOPIC);
+        }
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef HISTOGRAM
+#define HISTOGRAM
+
+#include <stdint.h>
+#include <ArduinoJson.h>
+#include "definitions.h"
+
+// Latency histogram with fixed, exponential buckets.
+// Upper bound of the bucket i is LATENCY_FIRST_BUCKET * 4^i microseconds, the last bucket has no upper bound.
+// Adding a sample is a few shifts, no allocation.
+class LatencyHistogram {
+
+    uint32_t buckets[LATENCY_BUCKETS] = {0};
+    uint32_t count = 0;
+    uint32_t max = 0;
+
+    public:
+        void add(uint32_t latency) {
+            uint8_t bucket = 0;
+            uint32_t bound = LATENCY_FIRST_BUCKET;
+            while (bucket < LATENCY_BUCKETS - 1 && latency > bound) {
+                bucket++;
+                bound <<= 2;
+            }
+            buckets[bucket]++;
+            count++;
+            max = (latency > max) ? latency : max;
+        }
+
+        uint32_t getCount() {
+            return count;
+        }
+
+        // Upper bound of the bucket which contains the percentile (the maximum for the last bucket)
+        uint32_t percentile(uint8_t percent) {
+            uint32_t target = ((uint64_t) count * percent + 99) / 100;
+            uint32_t seen = 0;
+            uint32_t bound = LATENCY_FIRST_BUCKET;
+            for (uint8_t i = 0; i < LATENCY_BUCKETS - 1; i++) {
+                seen += buckets[i];
+                if (seen >= target) {
+                    return (bound < max) ? bound : max;
+                }
+                bound <<= 2;
+            }
+            return max;
+        }
+
+        // Buckets are listed till the last not empty one
+        void fill(JsonObject histogram) {
+            histogram["count"] = count;
+            if (count == 0) {
+                return;
+            }
+            histogram["max"] = max;
+            histogram["p50"] = percentile(50);
+            histogram["p90"] = percentile(90);
+            histogram["p99"] = percentile(99);
+
+            int8_t last = LATENCY_BUCKETS - 1;
+            while (last > 0 && buckets[last] == 0) {
+                last--;
+            }
+            JsonArray values = histogram.createNestedArray("buckets");
+            for (int8_t i = 0; i <= last; i++) {
+                values.add(buckets[i]);
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef INTAKE
+#define INTAKE
+
+#include <stdint.h>
+#include "utilities.cpp"
+#include "adparser.cpp"
+#include "macfilter.cpp"
+#include "rpa.cpp"
+
+// Keys of a received advertisement, the same steps on the radio (BleScanner::onResult) and in the replay (tools/replay):
+// the private address is resolved, the beacon identity is read from the payload, then the observed only filter is applied.
+// Returns false if the advertisement is dropped by the filter.
+static inline boolean admitAdvertisement(RpaResolver &resolver, MacFilter &filter, uint64_t address, boolean randomAddress,
+        const uint8_t* payload, uint8_t payloadLength, uint64_t &key, uint64_t &identity) {
+    uint64_t resolvedKey = resolver.resolve(address, randomAddress);
+    key = (resolvedKey != 0) ? resolvedKey : address;
+    identity = beaconIdentity(payload, payloadLength);
+    return filter.accept(key) || (identity != 0 && filter.accept(identity));
+}
+
+// Entry of the Identity Resolving Key list: <device>=<IRK as 32 hex digits>, e.g. 317234b9d2d0=ec0234a357c8ad05341010a60a397d9b
+// The entry is modified. Returns false if it is invalid.
+static inline boolean parseIdentityResolvingKey(char* entry, IdentityResolvingKey &irk) {
+    char *separator = strchr(entry, '=');
+    if (separator == NULL) {
+        return false;
+    }
+    *separator = '\0';
+    const char* end = parseHexBytes(separator + 1, irk.irk, sizeof(irk.irk));
+    return end != NULL && *end == '\0' && parseDeviceId(entry, irk.key);
+}
+
+#endif
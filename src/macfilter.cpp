@@ -0,0 +1,56 @@
+#ifndef MACFILTER
+#define MACFILTER
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+// Membership filter of the observed devices for the BLE task.
+// accept() is a binary search in a sorted array: no allocation, no String, a few dozen cycles for a stranger.
+// The array is double buffered: set() fills the inactive one and switches over, so the BLE task is never blocked
+// and never sees a half written list. set() must be called from one task only (Arduino loop).
+class MacFilter {
+
+    std::vector<uint64_t> tables[2];
+    std::atomic<int8_t> active;     // index of the table in use, -1: no filter, everything is accepted
+    std::atomic<uint8_t> readers;   // accept() calls in progress
+
+    public:
+        MacFilter() : active(-1), readers(0) {
+        }
+
+        // BLE task side
+        bool accept(uint64_t key) {
+            readers.fetch_add(1);
+            int8_t index = active.load();
+            bool found = (index < 0) || std::binary_search(tables[index].begin(), tables[index].end(), key);
+            readers.fetch_sub(1);
+            return found;
+        }
+
+        // Empty list switches the filter off
+        void set(const std::vector<uint64_t> &keys) {
+            if (keys.empty()) {
+                active.store(-1);
+                return;
+            }
+
+            int8_t next = (active.load() == 0) ? 1 : 0;
+            // A reader which started before the last switch may still use the other table
+            while (readers.load() > 0) {
+                yield();
+            }
+            tables[next] = keys;
+            std::sort(tables[next].begin(), tables[next].end());
+            active.store(next);
+        }
+
+        size_t size() {
+            int8_t index = active.load();
+            return (index < 0) ? 0 : tables[index].size();
+        }
+};
+
+#endif
@@ -8,7 +8,18 @@
 #include "log.hpp"
 #include "utilities.cpp"
 #include "database.cpp"
+#include "histogram.cpp"
+#include "mqttqueue.cpp"
+#include "reconnect.cpp"
+#include "topicbuffer.cpp"
 #include <Callback.h>
+#include <ArduinoJson.h>
+
+#define LATENCY_DETECTION 0     // last advertisement -> state change
+#define LATENCY_QUEUE 1         // state change -> taken from the outbound queue
+#define LATENCY_WRITE 2         // taken from the queue -> written to the socket
+#define LATENCY_TOTAL 3         // last advertisement -> written to the socket
+#define LATENCY_STAGES 4
 
 class Mqtt {
 
@@ -17,7 +28,9 @@ class Mqtt {
     MqttClient* client;
     Database* database;
     Signal<int>* errorCodeChanged;
-    Signal<String>* mqttMessageArrived;
+    Signal<char*>* mqttMessageArrived;
+    Signal<MQTTInboundMessage>* topicMessageArrived; // messages of the other subscriptions (not commands)
+    std::vector<String> subscriptions;
     String server;
     String user;
     String password;
@@ -26,33 +39,61 @@ class Mqtt {
     String deviceID;
     int port;
     String baseTopic;
+    // <base topic>/ prefix is copied once, the device topics are appended at send (no String building per message)
+    TopicBuffer topics;
+    String longTopic;
+    // Payloads of the device states, reloaded when the config changes
+    PresenceStrings presenceStrings;
+    String commandTopic;                    // <base topic>/in
+
+    // Incoming payloads are read here in bulk and parsed in place by the receivers
+    char inboundBuffer[MQTT_INBOUND_SIZE + 1];
+    uint32_t inboundMessages = 0;
+    uint32_t inboundOversize = 0;
 
     String deviceIPAddress = "undefined";
 
-    // MQTT connect try
-    int lasttry = 10000;
-    int maxtry = 10;
+    // Reconnect with exponential backoff and jitter, the loop() is never blocked longer than the socket timeout
+    ReconnectBackoff reconnectBackoff;
+    IPAddress brokerAddress;
+    boolean brokerResolved = false;         // DNS lookup is done once, again only after a long outage
 
     boolean networkConnected = false; // Connected to the network (Wifi STA)
     boolean subscribed = false;
     boolean lastWillRetain = false;
 
+    // Outbound messages wait here for the connection, the backlog is sent out at most sendRate / second after the reconnect
+    MqttQueue queue;
+    int sendRate = MQTT_DEFAULT_SEND_RATE;
+    unsigned long lastSend = 0;
+
+    // Presence latency per path (arrival, departure) and stage
+    LatencyHistogram latency[2][LATENCY_STAGES];
+    unsigned long lastLatencyPublish = 0;
+
     public:
         Mqtt(Log& rlog) : logger(rlog, "[MQTT]") {
             this -> client = new MqttClient(wifiClient);
         }
 
-        void setup(Database &database, Signal<int> &errorCodeChanged, Signal<String> &mqttMessageArrived) {
+        void setup(Database &database, Signal<int> &errorCodeChanged, Signal<char*> &mqttMessageArrived, Signal<MQTTInboundMessage> &topicMessageArrived) {
 
             this -> database = &database;
             this -> errorCodeChanged = &errorCodeChanged;
             this -> mqttMessageArrived = &mqttMessageArrived;
+            this -> topicMessageArrived = &topicMessageArrived;
             
             this -> user = this -> database -> getValueAsString(String(DB_MQTT_USER), false);
             this -> password = this -> database -> getValueAsString(String(DB_MQTT_PW), false);
             this -> port =  this -> database -> getValueAsInt(String(DB_MQTT_PORT), false);
+            if (this -> port <= 0) {
+                this -> port = MQTT_DEFAULT_PORT;
+            }
             this -> server = this -> database -> getValueAsString(String(DB_MQTT_SERVER), false);
             this -> baseTopic = this -> database -> getValueAsString(String(DB_MQTT_TOPIC_PREFIX), false) + MQTT_TOPIC;
+            this -> topics.setBase(baseTopic);
+            this -> presenceStrings.load(database);
+            this -> commandTopic = baseTopic + MQTT_IN_POSTFIX;
 
             this -> lastWillRetain = this -> database -> getValueAsBoolean(String(DB_DEVICE_STATUS_RETAIN), false, MQTT_STATUS_OFF_DEFAULT_RETAIN);
             
@@ -75,6 +116,19 @@ class Mqtt {
                 client->setId(deviceID);
             }
             this -> client -> setUsernamePassword(user, password);
+
+            // Dead broker (black hole) must not block the BLE scan and the web server for long
+            wifiClient.setTimeout(MQTT_SOCKET_TIMEOUT);
+            this -> client -> setConnectionTimeout(MQTT_CONNACK_TIMEOUT);
+            int keepAlive = this -> database -> getValueAsInt(String(DB_MQTT_KEEPALIVE), false);
+            if (keepAlive > 0) {
+                this -> client -> setKeepAliveInterval((unsigned long) keepAlive * 1000);
+            }
+
+            int rate = this -> database -> getValueAsInt(String(DB_MQTT_SEND_RATE), false);
+            if (rate > 0) {
+                this -> sendRate = rate;
+            }
             
         }
 
@@ -89,7 +143,14 @@ class Mqtt {
 
                     int messageSize = client -> parseMessage();
                     if (messageSize) {
-                       processMessage();
+                       processMessage(messageSize);
+                    }
+
+                    sendQueued();
+
+                    if (millis() - lastLatencyPublish > LATENCY_PUBLISH_INTERVAL) {
+                        lastLatencyPublish = millis();
+                        publishLatency();
                     }
                 } else {
                     client->stop();
@@ -105,16 +166,75 @@ class Mqtt {
         void setConnected (boolean networkConnected) {
             this->logger << "Wifi connection is " << (String)networkConnected;
             this->networkConnected = networkConnected;            
+            if (networkConnected) {
+                // New network connection, the broker is tried at once
+                reconnectBackoff.reset();
+            }
         }
 
+        // Sent at once while the broker is connected and nothing is waiting, otherwise queued (see sendQueued())
         void sendMqttMessage(MQTTMessage message) {
-            if (client->connected()) {
-                String topic = baseTopic + "/";
-                if (message.individualTopic) {
-                    topic = "";
+            if (networkConnected && queue.depth() == 0 && client->connected() && publish(message, micros())) {
+                return;
+            }
+            queue.push(std::move(message));
+        }
+
+        // Device state: the topic is written into the topic buffer and the payload is one of the cached presence strings,
+        // nothing is allocated. It becomes an MQTTMessage only if it has to wait in the queue.
+        void sendState(StateMessage state) {
+            if (database -> getConfig().version != presenceStrings.version) {
+                presenceStrings.load(*database);
+            }
+            const String &payload = presenceStrings.get(state.available);
+
+            if (networkConnected && queue.depth() == 0 && client->connected()) {
+                const char* topic = topics.device(state.key);
+                uint32_t dequeued = micros();
+                if (topic != NULL && sendMqttMessage(topic, payload, true)) {
+                    recordLatency(state.latencyPath, state.transitionTime, state.detectionLatency, dequeued, micros());
+                    return;
                 }
-                sendMqttMessage(topic + message.topic, message.payload, message.retain);
             }
+
+            char mac[KEY_STRING_LENGTH + 1];
+            formatKey(state.key, mac);
+            MQTTMessage message = MQTTMessage{mac, payload, true};
+            message.coalesce = true;
+            message.latencyPath = state.latencyPath;
+            message.transitionTime = state.transitionTime;
+            message.detectionLatency = state.detectionLatency;
+            queue.push(std::move(message));
+        }
+
+        // Outbound queue size: one state per device of the device table and the other messages
+        void setQueueCapacity(int devices) {
+            queue.setCapacity(devices + MQTT_QUEUE_SIZE);
+        }
+
+        void fillStats(JsonObject stats) {
+            JsonObject mqttStats = stats.createNestedObject("mqtt");
+            mqttStats["connected"] = (boolean) client->connected();
+            mqttStats["connect_attempts"] = reconnectBackoff.getAttempts();
+            mqttStats["connect_failures"] = reconnectBackoff.getFailures();
+            mqttStats["backoff"] = reconnectBackoff.getBackoff();
+            mqttStats["queue_size"] = queue.capacity();
+            mqttStats["queue_depth"] = queue.depth();
+            mqttStats["queue_high_water_mark"] = queue.getHighWaterMark();
+            mqttStats["queue_coalesced"] = queue.getCoalesced();
+            mqttStats["queue_dropped"] = queue.getDropped();
+            mqttStats["send_rate"] = sendRate;
+            mqttStats["inbound_messages"] = inboundMessages;
+            mqttStats["inbound_oversize"] = inboundOversize;
+
+            JsonObject latencyStats = stats.createNestedObject("latency");
+            fillLatency(latencyStats);
+        }
+
+        // Extra subscription (full topic, wildcards are allowed), its messages are fired on topicMessageArrived
+        void addSubscription(String topic) {
+            subscriptions.push_back(topic);
+            subscribed = false;
         }
 
         void ipAddressChanged (String ipAddress) {
@@ -134,37 +254,171 @@ class Mqtt {
             
         }
 
-        void sendMqttMessage(String topic, String message, boolean retain = false) {
-            client -> beginMessage(topic, retain);            
+        // Backlog: one message per call, not more often than the send rate (the broker and the loop() are not flooded after a reconnect)
+        void sendQueued() {
+            if (queue.depth() == 0 || millis() - lastSend < (unsigned long) (1000 / sendRate)) {
+                return;
+            }
+
+            MQTTMessage message;
+            if (queue.pop(message)) {
+                lastSend = millis();
+                if (!publish(message, micros())) {
+                    // Connection is probably broken, try again after the reconnect
+                    queue.requeue(std::move(message));
+                }
+            }
+        }
+
+        // Written to the socket, returns false if it failed
+        boolean publish(const MQTTMessage &message, uint32_t dequeued) {
+            if (!sendMqttMessage(fullTopic(message), message.payload, message.retain)) {
+                return false;
+            }
+            recordLatency(message.latencyPath, message.transitionTime, message.detectionLatency, dequeued, micros());
+            return true;
+        }
+
+        void recordLatency(uint8_t latencyPath, uint32_t transitionTime, uint32_t detectionLatency, uint32_t dequeued, uint32_t written) {
+            if (latencyPath == LATENCY_NONE) {
+                return;
+            }
+            LatencyHistogram* histograms = latency[(latencyPath == LATENCY_ARRIVAL) ? 0 : 1];
+            histograms[LATENCY_DETECTION].add(detectionLatency);
+            histograms[LATENCY_QUEUE].add(dequeued - transitionTime);
+            histograms[LATENCY_WRITE].add(written - dequeued);
+            uint64_t total = (uint64_t) detectionLatency + (written - transitionTime);
+            histograms[LATENCY_TOTAL].add((total > UINT32_MAX) ? UINT32_MAX : total);
+        }
+
+        void fillLatency(JsonObject latencyStats) {
+            const char* paths[] = {"arrival", "departure"};
+            const char* stages[] = {"detection", "queue", "write", "total"};
+            latencyStats["unit"] = "us";
+            for (int path = 0; path < 2; path++) {
+                JsonObject pathStats = latencyStats.createNestedObject(paths[path]);
+                for (int stage = 0; stage < LATENCY_STAGES; stage++) {
+                    latency[path][stage].fill(pathStats.createNestedObject(stages[stage]));
+                }
+            }
+        }
+
+        void publishLatency() {
+            if (latency[0][LATENCY_TOTAL].getCount() == 0 && latency[1][LATENCY_TOTAL].getCount() == 0) {
+                return;
+            }
+            DynamicJsonDocument document(LATENCY_JSON_SIZE);
+            fillLatency(document.to<JsonObject>());
+            String payload;
+            serializeJson(document, payload);
+            sendMqttMessage(baseTopic + LATENCY_TOPIC, payload);
+        }
+
+        // Device topics are under the base topic. The buffer is used till the next call.
+        const char* fullTopic(const MQTTMessage &message) {
+            if (message.individualTopic) {
+                return message.topic.c_str();
+            }
+            const char* topic = topics.append(message.topic);
+            if (topic == NULL) {
+                // Very long topic, rare
+                longTopic = baseTopic + "/" + message.topic;
+                return longTopic.c_str();
+            }
+            return topic;
+        }
+
+        boolean sendMqttMessage(const String &topic, const String &message, boolean retain = false) {
+            return sendMqttMessage(topic.c_str(), message, retain);
+        }
+
+        // Direct write, returns false if it failed
+        boolean sendMqttMessage(const char* topic, const String &message, boolean retain = false) {
+            // Size must be given, otherwise the payload is truncated at the buffer size of the client (256 bytes)
+            client -> beginMessage(topic, message.length(), retain);            
             client -> print(message);            
-            client -> endMessage();
+            return client -> endMessage() != 0;
         }
 
+        // One connect try if the backoff time is over
         void reconnect() {
-            if (!String("").equals(server)) {
-                const char* mqtt_s = const_cast<char*>(server.c_str());
-                if (!client -> connect(mqtt_s, port)) {                    
-                    logger << "MQTT connection failed! Error code = " << (String)client -> connectError();
-                    this -> errorCodeChanged->fire(ERROR_MQTT);
-                } else {
-                    logger << "Connection started.";
+            if (String("").equals(server)) {
+                // logger << "MQTT connection info is missing.");
+                return;
+            }
+            if (!reconnectBackoff.due(millis())) {
+                return;
+            }
+
+            if (!brokerResolved) {
+                brokerResolved = brokerAddress.fromString(server.c_str()) || WiFi.hostByName(server.c_str(), brokerAddress) == 1;
+                if (!brokerResolved) {
+                    logger << "MQTT broker address can not be resolved: " << server;
+                    connectFailed();
+                    return;
                 }
+            }
+
+            if (!client -> connect(brokerAddress, port)) {                    
+                connectFailed();
+                logger << "MQTT connection failed! Error code = " << (String)client -> connectError() << " Next try in " << (String)reconnectBackoff.getWait() << " ms";
             } else {
-                // logger << "MQTT connection info is missing.");
+                logger << "Connection started.";
+                reconnectBackoff.succeeded();
             }
         }
 
-        void processMessage() {
-             // we received a message, print out the topic and contents
-            logger << "Message received on topic: " << client -> messageTopic();
-            
-            String message = "";
-            while (client -> available()) {
-                message += (char) client -> read();
+        void connectFailed() {
+            this -> errorCodeChanged->fire(ERROR_MQTT);
+            if (reconnectBackoff.failed()) {
+                // The broker may have a new address
+                brokerResolved = false;
             }
-            // Broadcast MQTT message
-            this -> mqttMessageArrived->fire(message);
-            logger << "Message: " << message;
+        }
+
+        void processMessage(int messageSize) {
+            inboundMessages++;
+            // The client keeps the topic in a String, this is the only copy
+            String topic = client -> messageTopic();
+
+            if (messageSize > MQTT_INBOUND_SIZE) {
+                // It must be read out of the stream anyway
+                while (client -> available()) {
+                    if (client -> read((uint8_t*) inboundBuffer, MQTT_INBOUND_SIZE) <= 0) {
+                        break;
+                    }
+                }
+                inboundOversize++;
+                if (topic.startsWith(commandTopic)) {
+                    logger << "Config command rejected, it is longer than " << (String)MQTT_INBOUND_SIZE
+                        << " bytes (" << (String)MQTT_OBSERVED_DEVICES << " observed devices). Size: " << (String)messageSize;
+                } else {
+                    logger << "Too long message dropped. Topic: " << topic << " Size: " << (String)messageSize;
+                }
+                return;
+            }
+
+            size_t length = 0;
+            while (length < (size_t) messageSize && client -> available()) {
+                int read = client -> read((uint8_t*) inboundBuffer + length, messageSize - length);
+                if (read <= 0) {
+                    break;
+                }
+                length += read;
+            }
+            inboundBuffer[length] = '\0';
+
+            if (!topic.startsWith(commandTopic)) {
+                // Other subscriptions, they can be frequent, no log here
+                this -> topicMessageArrived->fire(MQTTInboundMessage{topic.c_str(), inboundBuffer, length});
+                return;
+            }
+
+            // we received a message, print out the topic and contents
+            logger << "Message received on topic: " << topic;
+            logger << "Message: " << inboundBuffer;
+            // Broadcast MQTT message (the buffer is parsed in place)
+            this -> mqttMessageArrived->fire(inboundBuffer);
         }
 
         void subscribeForBaseTopic () {
@@ -174,6 +428,10 @@ class Mqtt {
             // subscribe to a topic and send an 'I'm alive' message
             String subscription = baseTopic + MQTT_IN_POSTFIX + "/#";
             client -> subscribe(subscription);
+            for (size_t i = 0; i < subscriptions.size(); i++) {
+                client -> subscribe(subscriptions[i]);
+                logger << "Subscribed to topic " << subscriptions[i];
+            }
             sendMqttMessage(baseTopic, "{\"status\": \"" + statusOn + "\", \"ip\":\"" + this -> deviceIPAddress + "\"}");
             logger << "Subscribed to topic " << subscription;
 
@@ -0,0 +1,153 @@
+#ifndef MQTTQUEUE
+#define MQTTQUEUE
+
+#include <vector>
+#include "definitions.h"
+#include "utilities.cpp"
+
+// Bounded outbound MQTT queue. The messages wait here while the broker is not available, they are sent out after the reconnect.
+// Device states (MQTTMessage::coalesce: retained, one topic per device) are coalesced: a queued state is overwritten
+// by the next one of the same topic and it keeps its place in the line, so a flapping device costs one message.
+// The other messages (chunked RSSI summaries, snapshots, discovery) are queued one by one, they are never merged.
+// The limit is one state per device of the device table plus MQTT_QUEUE_SIZE other messages (see setCapacity()),
+// the slots are allocated only when they are needed.
+// Full queue: the oldest not retained message is dropped for the new one, if there is none, the oldest retained one.
+class MqttQueue {
+
+    struct Slot {
+        MQTTMessage message;
+        uint32_t sequence;      // order of the arrival
+        uint32_t topicHash;     // coalesced messages only
+        boolean used;
+    };
+
+    std::vector<Slot> slots;
+    size_t limit = MQTT_QUEUE_SIZE;
+    uint32_t nextSequence = 0;
+    uint32_t frontSequence = 0;     // requeued messages go before every other one
+    uint16_t count = 0;
+
+    // Statistics
+    uint32_t coalesced = 0;
+    uint32_t dropped = 0;
+    uint16_t highWaterMark = 0;
+
+    public:
+        // Number of the messages, not smaller than MQTT_QUEUE_SIZE and the slots what are already allocated
+        void setCapacity(size_t limit) {
+            limit = (limit < MQTT_QUEUE_SIZE) ? MQTT_QUEUE_SIZE : limit;
+            this -> limit = (limit < slots.size()) ? slots.size() : limit;
+        }
+
+        void push(MQTTMessage message) {
+            insert(std::move(message), nextSequence++, true);
+        }
+
+        // Message which could not be sent, it goes to the front of the line.
+        // If a newer state of the same topic is queued meanwhile, that one wins.
+        void requeue(MQTTMessage message) {
+            insert(std::move(message), --frontSequence, false);
+        }
+
+        // Oldest message. Returns false if the queue is empty.
+        boolean pop(MQTTMessage &message) {
+            int oldest = -1;
+            for (size_t i = 0; i < slots.size(); i++) {
+                if (slots[i].used && (oldest < 0 || isOlder(slots[i], slots[oldest]))) {
+                    oldest = i;
+                }
+            }
+            if (oldest < 0) {
+                return false;
+            }
+
+            // Moved out, the slot does not keep the memory
+            message = std::move(slots[oldest].message);
+            slots[oldest].used = false;
+            count--;
+            return true;
+        }
+
+        uint16_t depth() {
+            return count;
+        }
+
+        uint16_t capacity() {
+            return limit;
+        }
+
+        uint32_t getCoalesced() {
+            return coalesced;
+        }
+
+        uint32_t getDropped() {
+            return dropped;
+        }
+
+        uint16_t getHighWaterMark() {
+            return highWaterMark;
+        }
+
+    private:
+        // newer: the message is newer than the queued ones (it overwrites the queued state of the same topic)
+        void insert(MQTTMessage message, uint32_t sequence, boolean newer) {
+            uint32_t hash = message.coalesce ? topicHash(message) : 0;
+            int free = -1;
+            int oldestNotRetained = -1;
+            int oldestRetained = -1;
+
+            for (size_t i = 0; i < slots.size(); i++) {
+                Slot &slot = slots[i];
+                if (!slot.used) {
+                    free = (free < 0) ? i : free;
+                    continue;
+                }
+                if (message.coalesce && slot.message.coalesce && slot.topicHash == hash
+                        && slot.message.individualTopic == message.individualTopic && slot.message.topic == message.topic) {
+                    if (newer) {
+                        slot.message = std::move(message);
+                    }
+                    coalesced++;
+                    return;
+                }
+                int &oldest = slot.message.retain ? oldestRetained : oldestNotRetained;
+                if (oldest < 0 || isOlder(slot, slots[oldest])) {
+                    oldest = i;
+                }
+            }
+
+            if (free < 0 && slots.size() < limit) {
+                slots.push_back(Slot{MQTTMessage(), 0, 0, false});
+                free = slots.size() - 1;
+            }
+            if (free < 0) {
+                dropped++;
+                free = (oldestNotRetained >= 0) ? oldestNotRetained : oldestRetained;
+                count--;
+            }
+
+            slots[free].message = std::move(message);
+            slots[free].sequence = sequence;
+            slots[free].topicHash = hash;
+            slots[free].used = true;
+            count++;
+            highWaterMark = (count > highWaterMark) ? count : highWaterMark;
+        }
+
+        // FNV-1a, the topics are compared only if the hashes are the same
+        static uint32_t topicHash(const MQTTMessage &message) {
+            uint32_t hash = 2166136261u;
+            const char* topic = message.topic.c_str();
+            for (size_t i = 0; i < message.topic.length(); i++) {
+                hash = (hash ^ (uint8_t) topic[i]) * 16777619u;
+            }
+            return hash;
+        }
+
+        // Sequence numbers can overflow, compare by difference
+        static boolean isOlder(const Slot &a, const Slot &b) {
+            return (int32_t) (a.sequence - b.sequence) < 0;
+        }
+};
+
+#endif
@@ -0,0 +1,168 @@
+#ifndef NVSSTORE
+#define NVSSTORE
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <ArduinoJson.h> // version 6
+#include <vector>
+#include "definitions.h"
+
+// Persistent store of the settings in the NVS partition (Preferences).
+// NVS is wear-leveled: it appends the entries into its pages, a page is erased only when it is full and its live entries
+// are moved (compaction is done by NVS), every entry has a CRC which is checked at read. So a changed setting costs one
+// entry write, not the rewrite of all settings. Unchanged values are not written at all.
+// Preferences can not list the keys of a namespace, the list is stored under STORE_INDEX_KEY (written only if a key is added).
+class NvsStore {
+
+    Preferences preferences;
+    std::vector<String> keys;
+
+    // Statistics
+    uint32_t keyWrites = 0;         // changed values written
+    uint32_t skippedWrites = 0;     // unchanged values (not written)
+    uint32_t changedBytes = 0;      // key + value bytes of the changed values
+    uint32_t flashBytes = 0;        // NVS entry bytes written for them (32 byte entries, without the page compaction)
+    uint32_t rejectedKeys = 0;      // keys longer than STORE_KEY_LENGTH (not stored)
+
+    public:
+        // Returns false if the store is empty (first boot or first boot after the EEPROM version)
+        boolean begin() {
+            preferences.begin(STORE_NAMESPACE, false);
+            String index = preferences.getString(STORE_INDEX_KEY, "");
+            keys.clear();
+            int start = 0;
+            while (start < (int) index.length()) {
+                int end = index.indexOf(PARSE_CHAR, start);
+                end = (end < 0) ? index.length() : end;
+                if (end > start) {
+                    keys.push_back(index.substring(start, end));
+                }
+                start = end + 1;
+            }
+            return !keys.empty();
+        }
+
+        // Returns false if the document is full, the rest of the values are not read
+        boolean readAll(JsonDocument &document) {
+            for (size_t i = 0; i < keys.size(); i++) {
+                document[keys[i]] = preferences.getString(keys[i].c_str(), "");
+                if (document.overflowed()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Writes the changed values only. Returns the number of the written values.
+        // Keys longer than the NVS limit are not stored, they are listed in rejected (separated by PARSE_CHAR).
+        int write(JsonDocument &document, String &rejected) {
+            int written = 0;
+            boolean indexChanged = false;
+            JsonObject root = document.as<JsonObject>();
+            for (JsonPair keyValue : root) {
+                const char* key = keyValue.key().c_str();
+                if (strlen(key) > STORE_KEY_LENGTH) {
+                    rejected += (rejected.length() > 0) ? PARSE_CHAR : "";
+                    rejected += key;
+                    rejectedKeys++;
+                    continue;
+                }
+                String value = keyValue.value().as<String>();
+                boolean known = isKnown(key);
+                if (known && preferences.getString(key, "") == value) {
+                    skippedWrites++;
+                    continue;
+                }
+                preferences.putString(key, value);
+                written++;
+                keyWrites++;
+                changedBytes += strlen(key) + value.length();
+                flashBytes += entryBytes(value.length());
+                if (!known) {
+                    keys.push_back(String(key));
+                    indexChanged = true;
+                }
+            }
+
+            if (indexChanged) {
+                writeIndex();
+            }
+            return written;
+        }
+
+        void remove(const char* key) {
+            preferences.remove(key);
+            for (size_t i = 0; i < keys.size(); i++) {
+                if (keys[i] == key) {
+                    keys.erase(keys.begin() + i);
+                    writeIndex();
+                    break;
+                }
+            }
+        }
+
+        // Binary values, they are not in the key index (not part of the JSON settings)
+        size_t blobLength(const char* key) {
+            return preferences.isKey(key) ? preferences.getBytesLength(key) : 0;
+        }
+
+        size_t readBlob(const char* key, void* buffer, size_t length) {
+            return preferences.getBytes(key, buffer, length);
+        }
+
+        void writeBlob(const char* key, const void* data, size_t length) {
+            preferences.putBytes(key, data, length);
+            keyWrites++;
+            changedBytes += length;
+            flashBytes += blobEntryBytes(length);
+        }
+
+        void clear() {
+            preferences.clear();
+            keys.clear();
+        }
+
+        void fillStats(JsonObject stats) {
+            stats["keys"] = keys.size();
+            stats["free_entries"] = preferences.freeEntries();
+            stats["writes"] = keyWrites;
+            stats["skipped_writes"] = skippedWrites;
+            stats["changed_bytes"] = changedBytes;
+            stats["flash_bytes"] = flashBytes;
+            stats["rejected_keys"] = rejectedKeys;
+            // Flash bytes per changed byte (the EEPROM version wrote 2 x EEPROM_SIZE per save). The entries copied by the
+            // page compaction of NVS are not visible here, test_flashwear measures them on a flash model.
+            stats["write_amplification"] = (changedBytes > 0) ? (float) flashBytes / changedBytes : 0;
+        }
+
+    private:
+        void writeIndex() {
+            String index = "";
+            for (size_t i = 0; i < keys.size(); i++) {
+                index += (i > 0) ? PARSE_CHAR + keys[i] : keys[i];
+            }
+            preferences.putString(STORE_INDEX_KEY, index);
+            flashBytes += entryBytes(index.length());
+        }
+
+        boolean isKnown(const char* key) {
+            for (size_t i = 0; i < keys.size(); i++) {
+                if (keys[i] == key) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // A string is one header entry and the data entries (zero terminated)
+        static uint32_t entryBytes(size_t length) {
+            return STORE_ENTRY_SIZE * (1 + (length + STORE_ENTRY_SIZE) / STORE_ENTRY_SIZE);
+        }
+
+        // A blob is a chunk (header entry and the data entries) and an index entry
+        static uint32_t blobEntryBytes(size_t length) {
+            return STORE_ENTRY_SIZE * (2 + (length + STORE_ENTRY_SIZE - 1) / STORE_ENTRY_SIZE);
+        }
+};
+
+#endif
@@ -0,0 +1,439 @@
+#ifndef PRESENCE
+#define PRESENCE
+
+#include "definitions.h"
+#include "utilities.cpp"
+#include "devicetable.cpp"
+#include "timerwheel.cpp"
+#include <algorithm>
+#include <math.h>
+#include <vector>
+
+// Receiver of the presence logic results
+class PresenceListener {
+    public:
+        virtual ~PresenceListener() {}
+
+        // A device, which was not in the table, is found
+        virtual void deviceFound(const Device &device) {}
+
+        // Device is not seen for a while, but it has more chances (mark)
+        virtual void deviceMarked(const Device &device) {}
+
+        // Device became available or not available
+        virtual void presenceChanged(const Device &device) = 0;
+
+        // Periodic resend of the unchanged state (e.g. retained messages of a restarted broker)
+        virtual void presenceRefresh(const Device &device) {}
+};
+
+// Signal filter settings of the presence logic
+struct PresenceConfig {
+    uint8_t rssiSmoothing = 100;        // EMA weight of the new RSSI sample in percent, 100 means no smoothing
+    int8_t enterRssi = RSSI_FILTER_OFF; // not available device becomes available only above this (filtered) RSSI
+    int8_t exitRssi = RSSI_FILTER_OFF;  // available device is handled as not seen below this (filtered) RSSI
+    uint32_t minDwell = 0;              // milliseconds, minimum time between two state changes of a device
+    boolean beaconIdentity = false;     // key every recognized beacon on its identity instead of the MAC
+    // Departure timeout (all of the marks together)
+    uint8_t confidence = 0;             // percent, learned from the advertising interval of the device (see stageTimeout()). 0: fixed timeout (the ceiling)
+    uint32_t timeoutFloor = BT_ADAPTIVE_TIMEOUT_FLOOR;
+    uint32_t timeoutCeiling = BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT;
+};
+
+// Presence logic: advertisements in, state changes out.
+// It does not know the radio and it does not read the clock, time is always passed by the caller.
+// The same logic can be fed by the BLE scanner or by a recorded trace (even faster than real time).
+class Presence {
+
+    PresenceListener* listener = NULL;
+    boolean observedOnly = false; // Track only the devices of the observed list (see setObserved())
+    PresenceConfig config;
+    uint32_t suppressedTransitions = 0; // State changes held back by the filter (= saved messages)
+
+    // Table size limit, the least recently seen unobserved device is evicted for a new one. 0: no limit.
+    int capacity = 0;
+    uint32_t evictions = 0;
+
+    // Periodic refresh: one device per step, the steps are spread over BT_LIST_REBUILD_INTERVAL
+    int refreshCursor = 0;
+    uint32_t nextRefresh = 0;
+
+    DeviceTable devices;
+    // Deadlines of the devices, only the due devices are checked in a loop()
+    TimerWheel<BT_TIMER_WHEEL_SLOTS, BT_TIMER_WHEEL_RESOLUTION> expiryWheel;
+
+    public:
+        void setup(PresenceListener &listener, uint32_t now) {
+            this -> listener = &listener;
+            expiryWheel.start(now);
+            nextRefresh = now + BT_LIST_REBUILD_INTERVAL;
+        }
+
+        void setCapacity(int capacity) {
+            this -> capacity = capacity;
+        }
+
+        int getCapacity() {
+            return capacity;
+        }
+
+        uint32_t getEvictions() {
+            return evictions;
+        }
+
+        void configure(const PresenceConfig &config) {
+            this -> config = config;
+            // Exit threshold above the enter threshold would make a device flap on every advertisement
+            if (this -> config.exitRssi > this -> config.enterRssi) {
+                this -> config.exitRssi = this -> config.enterRssi;
+            }
+            if (this -> config.timeoutFloor > this -> config.timeoutCeiling) {
+                this -> config.timeoutFloor = this -> config.timeoutCeiling;
+            }
+        }
+
+        // Reconcile the table with the observed device list in place, the learned state is kept.
+        // Missing observed devices are prefilled: they are reported as not available if they do not show up in time.
+        // In observed only mode the other devices are dropped. Returns the number of the new devices.
+        // Devices can be observed without the observed only mode (devices with an Identity Resolving Key).
+        int setObserved(const std::vector<uint64_t> &keys, uint32_t now, boolean observedOnly) {
+            std::vector<uint64_t> sorted = keys;
+            std::sort(sorted.begin(), sorted.end());
+            this -> observedOnly = observedOnly && !sorted.empty();
+
+            // Backwards, remove() moves the last (already visited) device to the index
+            for (int i = devices.size() - 1; i >= 0; i--) {
+                Device &dev = devices.get(i);
+                dev.observed = std::binary_search(sorted.begin(), sorted.end(), dev.mac);
+                if (!dev.observed && this -> observedOnly) {
+                    devices.remove(dev.mac);
+                } else if (dev.observed) {
+                    // Observed devices are never evicted
+                    devices.untrack(&dev);
+                } else {
+                    // No longer observed: it can be evicted again. The recency of the others is kept.
+                    devices.trackIfUnlinked(&dev);
+                }
+            }
+
+            int added = 0;
+            for (size_t i = 0; i < sorted.size(); i++) {
+                if (devices.find(sorted[i]) == NULL) {
+                    addObserved(sorted[i], now);
+                    added++;
+                }
+            }
+            return added;
+        }
+
+        int size() {
+            return devices.size();
+        }
+
+        uint32_t getSuppressedTransitions() {
+            return suppressedTransitions;
+        }
+
+        Device& get(int index) {
+            return devices.get(index);
+        }
+
+        void advertisement(const Advertisement &advertisement) {
+            uint64_t key = advertisement.mac;
+            uint32_t now = advertisement.timestamp;
+            Device* dev = NULL;
+
+            // Beacons are keyed on their identity if it is configured (or it is an observed identity)
+            if (advertisement.identity != 0) {
+                dev = devices.find(advertisement.identity);
+                if (dev != NULL || config.beaconIdentity) {
+                    key = advertisement.identity;
+                }
+            }
+            if (key == advertisement.mac) {
+                dev = devices.find(key);
+            }
+
+            if (dev != NULL) {
+                if (!dev->observed) {
+                    devices.touch(dev);
+                }
+                dev->rssi = advertisement.rssi;
+                filterRssi(*dev, advertisement.rssi);
+                if (dev->name[0] == '\0' && advertisement.name[0] != '\0') {
+                    memcpy(dev->name, advertisement.name, sizeof(dev->name));
+                }
+
+                if (!dev->available) {
+                    if (dev->rssiFiltered < config.enterRssi * 16 || !timeReached(now, dev->stateSince + config.minDwell)) {
+                        // Too weak or it has just gone, stay not available
+                        suppress(key, *dev, now);
+                        return;
+                    }
+                } else if (dev->rssiFiltered < config.exitRssi * 16) {
+                    // Too weak to keep it alive, it is handled as not seen
+                    return;
+                }
+
+                if (dev->available) {
+                    learnInterval(*dev, now - dev->lastSeen);
+                }
+                dev->lastSeen = now;
+                dev->mark = DEVICE_DROP_OUT_COUNT;
+                dev->suppressed = false;
+                // Gone devices have no check, the others will be rescheduled lazily
+                if (dev->timerSlot == TIMER_NONE) {
+                    scheduleCheck(key, *dev, dev->lastSeen + stageTimeout(*dev));
+                }
+                // Device came back (state changed)
+                if (!dev->available) {
+                    dev->available = true;
+                    dev->stateSince = now;
+                    listener->presenceChanged(*dev);
+                }
+                return;
+            }
+
+            if (!observedOnly && makeRoom()) {
+                Device newDevice = {};
+                newDevice.mac = key;
+                newDevice.lastSeen = now;
+                newDevice.stateSince = now;
+                newDevice.rssi = advertisement.rssi;
+                newDevice.mark = DEVICE_DROP_OUT_COUNT;
+                newDevice.available = true;
+                newDevice.observed = false;
+                memcpy(newDevice.name, advertisement.name, sizeof(newDevice.name));
+                filterRssi(newDevice, advertisement.rssi);
+
+                if (newDevice.rssiFiltered < config.enterRssi * 16) {
+                    // Weak device, keep it in the table (filter history) but do not report it
+                    newDevice.available = false;
+                    newDevice.mark = 0;
+                    newDevice.stateSince = now - config.minDwell;
+                    newDevice.timerSlot = TIMER_NONE;
+                    Device* added = devices.insert(key, newDevice);
+                    devices.touch(added);
+                    suppress(key, *added, now);
+                    return;
+                }
+
+                Device* added = devices.insert(key, newDevice);
+                devices.touch(added);
+                scheduleCheck(key, *added, added->lastSeen + stageTimeout(*added));
+
+                listener->deviceFound(*added);
+                listener->presenceChanged(*added);
+            }
+        }
+
+        // Check the devices which deadline is reached, refresh the next device if it is due
+        void loop(uint32_t now) {
+            expiryWheel.advance(now, [this, now](uint64_t key, uint16_t slot) {
+                checkDevice(key, slot, now);
+            });
+
+            if (devices.size() > 0 && timeReached(now, nextRefresh)) {
+                nextRefresh = now + BT_LIST_REBUILD_INTERVAL / devices.size();
+                refreshNext(now);
+            }
+        }
+
+    private:
+
+        // Evict the least recently seen unobserved device if the table is full.
+        // Returns false if there is no room (every device is observed).
+        boolean makeRoom() {
+            if (capacity <= 0 || devices.size() < capacity) {
+                return true;
+            }
+
+            Device* victim = devices.leastRecent();
+            if (victim == NULL) {
+                return false;
+            }
+
+            // Its state would stay "available" forever
+            if (victim->available) {
+                victim->available = false;
+                victim->rssi = 0;
+                listener->presenceChanged(*victim);
+            }
+            devices.remove(victim->mac);
+            evictions++;
+            return true;
+        }
+
+        // Prefill a device (not available till it shows up)
+        void addObserved(uint64_t key, uint32_t now) {
+            Device device = {};
+            device.mac = key;
+            device.lastSeen = now;
+            device.stateSince = now - config.minDwell; // it may arrive right away
+            device.mark = DEVICE_DROP_OUT_COUNT;
+            device.available = false;
+            device.observed = true;
+            Device* added = devices.insert(key, device);
+            scheduleCheck(key, *added, added->lastSeen + stageTimeout(*added));
+        }
+
+        // Age out the stale unobserved device or resend the state of the device at the cursor
+        void refreshNext(uint32_t now) {
+            if (refreshCursor >= devices.size()) {
+                refreshCursor = 0;
+            }
+
+            Device &dev = devices.get(refreshCursor);
+            if (!dev.observed && !dev.available && timeReached(now, dev.lastSeen + BT_DEVICE_STALE_TIMEOUT)) {
+                // The last device is moved to the cursor, it is the next one
+                devices.remove(dev.mac);
+                return;
+            }
+
+            // Prefilled observed devices are not reported yet (mark > 0)
+            if (dev.available || (dev.observed && dev.mark <= 0)) {
+                listener->presenceRefresh(dev);
+            }
+            refreshCursor++;
+        }
+
+        // Running estimate of the advertising interval and the miss rate from the time between two receptions.
+        // A gap of about k intervals means k - 1 missed advertisements (or scan windows) and a received one,
+        // the miss rate is averaged over the advertisements (not over the gaps, that would underestimate it).
+        void learnInterval(Device &device, uint32_t gap) {
+            if (gap < BT_ADAPTIVE_MIN_GAP) {
+                // Advertisement and scan response of the same event
+                return;
+            }
+
+            if (device.intervalSamples == 0) {
+                device.interval = gap;
+                device.missRate = 0;
+            } else {
+                uint32_t expected = (gap + device.interval / 2) / device.interval;
+                expected = (expected == 0) ? 1 : expected;
+                // EMA, weight of the new sample is 1/8
+                device.interval = (device.interval * 7 + gap / expected) / 8;
+                // EMA per advertisement, weight 1/16. After 16 misses in a row the estimate is near 1 anyway.
+                int missRate = device.missRate;
+                for (uint32_t i = 1; i < expected && i <= 16; i++) {
+                    missRate += (255 - missRate + 15) / 16;
+                }
+                missRate -= (missRate + 15) / 16;
+                device.missRate = missRate;
+            }
+            if (device.intervalSamples < 255) {
+                device.intervalSamples++;
+            }
+        }
+
+        // Time till the next mark. The whole departure timeout is divided between the marks.
+        // Adaptive: the device is gone when n advertisements are missed in a row. A present device has a run of n misses
+        // at any of its advertisements with missRate^n, the confidence is applied to all of the advertisements of
+        // BT_ADAPTIVE_PRESENCE_PERIOD: (period / interval) * missRate^n < 1 - confidence. So a slow or lossy device
+        // needs more misses than a fast one. n missed advertisements are a gap of n + 1 intervals.
+        uint32_t stageTimeout(const Device &device) {
+            uint32_t timeout = config.timeoutCeiling;
+
+            if (config.confidence > 0 && device.intervalSamples >= BT_ADAPTIVE_MIN_SAMPLES) {
+                // A few clean samples do not mean that the device is never missed
+                float missRate = device.missRate / 256.0f;
+                missRate = (missRate < 0.1f) ? 0.1f : missRate;
+                float advertisements = (float) (BT_ADAPTIVE_PRESENCE_PERIOD) / device.interval;
+                advertisements = (advertisements < 1) ? 1 : advertisements;
+                float intervals = ceilf(logf((100 - config.confidence) / 100.0f / advertisements) / logf(missRate));
+                // Half an interval for the jitter
+                float adaptive = device.interval * (intervals + 1.5f);
+                timeout = (adaptive >= config.timeoutCeiling) ? config.timeoutCeiling : (uint32_t) adaptive;
+                timeout = (timeout < config.timeoutFloor) ? config.timeoutFloor : timeout;
+            }
+
+            return timeout / DEVICE_DROP_OUT_COUNT;
+        }
+
+        void scheduleCheck(uint64_t key, Device &device, uint32_t deadline) {
+            device.timerSlot = expiryWheel.schedule(key, deadline);
+        }
+
+        // Exponential moving average in 1/16 dBm, the first sample initializes it
+        void filterRssi(Device &device, int8_t rssi) {
+            int16_t sample = rssi * 16;
+            if (!device.filterReady) {
+                device.rssiFiltered = sample;
+                device.filterReady = true;
+            } else {
+                device.rssiFiltered += ((int32_t) (sample - device.rssiFiltered) * config.rssiSmoothing) / 100;
+            }
+        }
+
+        // A state change is held back. It is counted once, till the device is quiet for a timeout.
+        void suppress(uint64_t key, Device &device, uint32_t now) {
+            if (!device.suppressed) {
+                device.suppressed = true;
+                suppressedTransitions++;
+            }
+            // Gone device has no pending not available report, it can be refreshed
+            if (device.mark <= 0) {
+                device.lastSeen = now;
+            }
+            // Ends the suppressed episode (see checkDevice)
+            if (device.timerSlot == TIMER_NONE) {
+                scheduleCheck(key, device, now + BT_DEVICE_TIMEOUT);
+            }
+        }
+
+        // Timer wheel callback: the deadline of the device is (might be) reached
+        void checkDevice(uint64_t key, uint16_t slot, uint32_t now) {
+            Device* dev = devices.find(key);
+            if (dev == NULL || dev->timerSlot != slot) {
+                // Removed device or an older entry of a rescheduled device
+                return;
+            }
+            dev->timerSlot = TIMER_NONE;
+
+            if (!dev->available && (dev->mark <= 0 || !dev->observed)) {
+                // Gone (or never reported) device, only its suppressed episode can be over
+                if (!timeReached(now, dev->lastSeen + BT_DEVICE_TIMEOUT)) {
+                    scheduleCheck(key, *dev, dev->lastSeen + BT_DEVICE_TIMEOUT);
+                } else {
+                    dev->suppressed = false;
+                    dev->mark = 0;
+                }
+                return;
+            }
+
+            uint32_t timeout = stageTimeout(*dev);
+            if (!timeReached(now, dev->lastSeen + timeout)) {
+                // Device was seen since the check was scheduled
+                scheduleCheck(key, *dev, dev->lastSeen + timeout);
+                return;
+            }
+
+            // Give another chance to the device to appear (Device has DEVICE_DROP_OUT_COUNT lives in the beginning)
+            dev->mark--;
+
+            if (dev->mark <= 0 && dev->available && !timeReached(now, dev->stateSince + config.minDwell)) {
+                // It has just arrived, keep it till the dwell time is over
+                dev->mark = 1;
+                if (!dev->suppressed) {
+                    dev->suppressed = true;
+                    suppressedTransitions++;
+                }
+                scheduleCheck(key, *dev, dev->stateSince + config.minDwell);
+            } else if (dev->mark <= 0) {
+                // Virtually remove the device, there is no more check till it appears again
+                dev->mark = 0;
+                dev->available = false;
+                dev->stateSince = now;
+                dev->suppressed = false;
+                dev->filterReady = false;
+                dev->rssi = 0;
+                listener->presenceChanged(*dev);
+            } else {
+                scheduleCheck(key, *dev, now + timeout);
+                listener->deviceMarked(*dev);
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef RECONNECT
+#define RECONNECT
+
+#include <Arduino.h>
+#include "definitions.h"
+
+// Connect schedule of the MQTT client: exponential backoff with jitter, one try at a time.
+// The wait doubles after every failure (MQTT_BACKOFF_MIN .. MQTT_BACKOFF_MAX) and it is randomized between
+// backoff / 2 and backoff, so the nodes do not reconnect at the same time after a broker restart.
+// Time is passed by the caller, the host test (test_reconnect) runs it against simulated broker outages.
+class ReconnectBackoff {
+
+    uint32_t lastTry = 0;
+    uint32_t wait = 0;                  // till the next try (0: try now)
+    uint32_t backoff = MQTT_BACKOFF_MIN;
+    uint32_t attempts = 0;
+    uint32_t failures = 0;
+
+    public:
+        // New network connection, the broker is tried at once
+        void reset() {
+            wait = 0;
+            backoff = MQTT_BACKOFF_MIN;
+        }
+
+        // True if a connect try can be made now, the try is counted
+        boolean due(uint32_t now) {
+            if (now - lastTry < wait) {
+                return false;
+            }
+            lastTry = now;
+            attempts++;
+            return true;
+        }
+
+        // Returns true if the backoff was already at its maximum (long outage, the broker may have a new address)
+        boolean failed() {
+            failures++;
+            wait = backoff / 2 + random(backoff / 2 + 1);
+            boolean longOutage = backoff >= MQTT_BACKOFF_MAX;
+            backoff = (backoff * 2 > MQTT_BACKOFF_MAX) ? MQTT_BACKOFF_MAX : backoff * 2;
+            return longOutage;
+        }
+
+        void succeeded() {
+            backoff = MQTT_BACKOFF_MIN;
+            wait = 0;
+        }
+
+        uint32_t getWait() { return wait; }
+        uint32_t getBackoff() { return backoff; }
+        uint32_t getAttempts() { return attempts; }
+        uint32_t getFailures() { return failures; }
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef RINGBUFFER
+#define RINGBUFFER
+
+#include <stdint.h>
+#include <atomic>
+
+// Fixed capacity, lock-free single producer / single consumer queue.
+// push() must be called from one task only (e.g. the BLE callback), pop() from one other task (Arduino loop).
+// SIZE must be a power of two. Items are copied, so T should be a small plain struct.
+template <typename T, uint32_t SIZE>
+class RingBuffer {
+
+    static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "RingBuffer size must be a power of two");
+
+    T items[SIZE];
+    std::atomic<uint32_t> head; // next write position, owned by the producer
+    std::atomic<uint32_t> tail; // next read position, owned by the consumer
+
+    // Statistics (written by the producer only)
+    std::atomic<uint32_t> dropped;
+    std::atomic<uint32_t> highWaterMark;
+
+    public:
+        RingBuffer() : head(0), tail(0), dropped(0), highWaterMark(0) {
+        }
+
+        // Producer side. Returns false (and counts it) if the queue is full.
+        bool push(const T& item) {
+            uint32_t currentHead = head.load(std::memory_order_relaxed);
+            uint32_t depth = currentHead - tail.load(std::memory_order_acquire);
+
+            if (depth >= SIZE) {
+                dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+
+            items[currentHead & (SIZE - 1)] = item;
+            head.store(currentHead + 1, std::memory_order_release);
+
+            if (depth + 1 > highWaterMark.load(std::memory_order_relaxed)) {
+                highWaterMark.store(depth + 1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+
+        // Consumer side. Returns false if the queue is empty.
+        bool pop(T& item) {
+            uint32_t currentTail = tail.load(std::memory_order_relaxed);
+            if (currentTail == head.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            item = items[currentTail & (SIZE - 1)];
+            tail.store(currentTail + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t depth() {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+
+        uint32_t capacity() {
+            return SIZE;
+        }
+
+        uint32_t getDropped() {
+            return dropped.load(std::memory_order_relaxed);
+        }
+
+        uint32_t getHighWaterMark() {
+            return highWaterMark.load(std::memory_order_relaxed);
+        }
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef ROOMFUSION
+#define ROOMFUSION
+
+#include <Arduino.h>
+#include <unordered_map>
+#include <vector>
+#include "definitions.h"
+#include "utilities.cpp"
+#include "adparser.cpp"
+
+// Output of the room fusion
+class RoomListener {
+    public:
+        virtual ~RoomListener() {}
+
+        // room: name of the room, NULL: the device is not in any room
+        virtual void roomChanged(uint64_t key, const char* room) = 0;
+};
+
+// Room assignment from the RSSI summaries of several nodes: every device goes to the strongest room which reported it
+// in the last FUSION_STALE_TIMEOUT, it moves to another room only if it is stronger there by FUSION_HYSTERESIS dB.
+// Like Presence, it does not know the network and it does not read the clock: the MQTT side is in fusion.cpp,
+// the host test feeds it with the summaries of simulated nodes.
+class RoomFusion {
+
+    struct RoomReading {
+        uint8_t room;           // index in rooms
+        int8_t rssi;
+        uint32_t time;          // time of the summary
+    };
+
+    struct FusedDevice {
+        RoomReading readings[FUSION_MAX_ROOMS];
+        uint8_t readingCount = 0;
+        int16_t room = -1;      // assigned room, -1: not present
+        boolean published = false;
+    };
+
+    RoomListener* listener = NULL;
+    std::vector<String> rooms;
+    std::unordered_map<uint64_t, FusedDevice> devices;
+
+    public:
+        void setup(RoomListener &listener) {
+            this -> listener = &listener;
+        }
+
+        // Summary of the node of a room (317234b9d2d0:-67,15172f81accc:-80), parsed in place.
+        // Returns true if the room is new.
+        boolean summaryArrived(const char* roomName, char* payload, uint32_t now) {
+            size_t roomCount = rooms.size();
+            uint8_t room = roomIndex(roomName);
+
+            char *payloadChar = payload; // strtok_r moves this pointer
+            char *entry;
+            while ((entry = strtok_r(payloadChar, ",", &payloadChar)) != NULL) {
+                char *separator = strchr(entry, ':');
+                uint64_t key;
+                if (separator == NULL) {
+                    continue;
+                }
+                *separator = '\0';
+                if (!parseDeviceId(entry, key)) {
+                    continue;
+                }
+                FusedDevice &device = devices[key];
+                addReading(device, room, atoi(separator + 1), now);
+                evaluate(key, device, now);
+            }
+            return rooms.size() > roomCount;
+        }
+
+        // Rooms which do not report a device any more
+        void loop(uint32_t now) {
+            for (auto entry = devices.begin(); entry != devices.end(); ) {
+                evaluate(entry->first, entry->second, now);
+                // Not present is sent out, it is recreated by the next summary which has it
+                if (entry->second.room < 0) {
+                    entry = devices.erase(entry);
+                } else {
+                    ++entry;
+                }
+            }
+        }
+
+        size_t size() {
+            return devices.size();
+        }
+
+    private:
+
+        uint8_t roomIndex(const char* name) {
+            for (size_t i = 0; i < rooms.size(); i++) {
+                if (rooms[i] == name) {
+                    return i;
+                }
+            }
+            if (rooms.size() == FUSION_MAX_ROOMS) {
+                // Unlikely, the last slot is shared
+                return FUSION_MAX_ROOMS - 1;
+            }
+            rooms.push_back(String(name));
+            return rooms.size() - 1;
+        }
+
+        void addReading(FusedDevice &device, uint8_t room, int rssi, uint32_t now) {
+            for (uint8_t i = 0; i < device.readingCount; i++) {
+                if (device.readings[i].room == room) {
+                    device.readings[i].rssi = rssi;
+                    device.readings[i].time = now;
+                    return;
+                }
+            }
+            if (device.readingCount < FUSION_MAX_ROOMS) {
+                device.readings[device.readingCount++] = RoomReading{room, (int8_t) rssi, now};
+            }
+        }
+
+        // Strongest fresh room, the current room is kept within the hysteresis
+        void evaluate(uint64_t key, FusedDevice &device, uint32_t now) {
+            int16_t best = -1;
+            int16_t bestRssi = -128;
+            int16_t currentRssi = -128;
+            boolean currentFresh = false;
+
+            for (uint8_t i = 0; i < device.readingCount; i++) {
+                RoomReading &reading = device.readings[i];
+                if (now - reading.time > FUSION_STALE_TIMEOUT) {
+                    continue;
+                }
+                if (reading.room == device.room) {
+                    currentFresh = true;
+                    currentRssi = reading.rssi;
+                }
+                if (best < 0 || reading.rssi > bestRssi) {
+                    best = reading.room;
+                    bestRssi = reading.rssi;
+                }
+            }
+
+            int16_t room = best;
+            if (currentFresh && bestRssi < currentRssi + FUSION_HYSTERESIS) {
+                room = device.room;
+            }
+
+            if (room != device.room || !device.published) {
+                device.room = room;
+                device.published = true;
+                listener->roomChanged(key, (room < 0) ? NULL : rooms[room].c_str());
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef RPA
+#define RPA
+
+#include <Arduino.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <mbedtls/aes.h>
+#include "definitions.h"
+
+// Identity Resolving Key of a device. The resolved advertisements get the key of the device.
+struct IdentityResolvingKey {
+    uint64_t key;           // device key (identity address), see parseDeviceId()
+    uint8_t irk[16];        // most significant byte first, as it is displayed
+};
+
+// Resolvable private address resolution (Bluetooth Core Spec Vol 3, Part H, 2.2.2).
+// Phones rotate their address every ~15 minutes: prand (upper 24 bits, top two bits 01) and hash = ah(IRK, prand) (lower 24 bits).
+// Every address is checked against the configured keys only once: the result (device key or not resolvable)
+// is cached, so a rotating address costs one AES operation per key per rotation period, not per advertisement.
+// The cache is sized from the device table limit (one entry per device in range) and it is RPA_CACHE_WAYS-way
+// set associative with second chance replacement, so a crowd of random addresses does not cycle it out.
+//
+// resolve() runs on the BLE task and owns the cache. The key list is double buffered like the MacFilter,
+// setKeys() must be called from one task only (Arduino loop). A new key list invalidates the cache.
+// setCacheSize() reallocates the cache, it must be called before the scan is started.
+class RpaResolver {
+
+    static const uint64_t REFERENCED = 1ULL << 63;     // second chance flag in CacheEntry::address
+
+    struct CacheEntry {
+        uint64_t address;   // 0: empty (never a resolvable address)
+        uint64_t key;       // 0: not resolvable with the current keys
+    };
+
+    std::vector<IdentityResolvingKey> tables[2];
+    std::atomic<int8_t> active;         // index of the key list in use, -1: no keys, nothing is resolved
+    std::atomic<uint8_t> readers;       // resolve() calls in progress
+    std::atomic<uint32_t> generation;   // incremented by setKeys()
+
+    // BLE task only
+    std::vector<CacheEntry> cache;
+    size_t cacheSetMask = 0;            // number of sets - 1, the number of sets is a power of two
+    uint32_t cacheGeneration = 0;
+
+    // Statistics (written by the BLE task only)
+    std::atomic<uint32_t> hits;
+    std::atomic<uint32_t> misses;
+    std::atomic<uint32_t> resolved;
+    std::atomic<uint32_t> aesOperations;
+
+    public:
+        RpaResolver() : active(-1), readers(0), generation(0), hits(0), misses(0), resolved(0), aesOperations(0) {
+            setCacheSize(RPA_CACHE_MIN_SIZE);
+        }
+
+        // Resolvable private address: random address type (TxAdd) and 01 in the top two bits.
+        // A public address with the same top bits is not.
+        static boolean isResolvable(uint64_t address, boolean randomAddress) {
+            return randomAddress && (address >> 46) == 0x01;
+        }
+
+        // Cache entries for this many devices, rounded up to a power of two, limited to RPA_CACHE_MIN_SIZE..RPA_CACHE_MAX_SIZE
+        void setCacheSize(int devices) {
+            size_t size = RPA_CACHE_MIN_SIZE;
+            while (size < (size_t) devices && size < RPA_CACHE_MAX_SIZE) {
+                size <<= 1;
+            }
+            cache.assign(size, CacheEntry{0, 0});
+            cacheSetMask = size / RPA_CACHE_WAYS - 1;
+        }
+
+        size_t getCacheSize() {
+            return cache.size();
+        }
+
+        // Random address hash function ah(k, r) = e(k, padding || r) mod 2^24
+        static uint32_t ah(const uint8_t irk[16], uint32_t prand) {
+            uint8_t block[16] = {0};
+            block[13] = (prand >> 16) & 0xFF;
+            block[14] = (prand >> 8) & 0xFF;
+            block[15] = prand & 0xFF;
+
+            uint8_t encrypted[16];
+            mbedtls_aes_context aes;
+            mbedtls_aes_init(&aes);
+            mbedtls_aes_setkey_enc(&aes, irk, 128);
+            mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, block, encrypted);
+            mbedtls_aes_free(&aes);
+
+            return ((uint32_t) encrypted[13] << 16) | ((uint32_t) encrypted[14] << 8) | encrypted[15];
+        }
+
+        // BLE task side. Returns the key of the device or 0 if the address is not resolvable.
+        // randomAddress: the advertisement has a random address (BLE_ADDR_TYPE_RANDOM)
+        uint64_t resolve(uint64_t address, boolean randomAddress) {
+            if (active.load() < 0 || !isResolvable(address, randomAddress)) {
+                return 0;
+            }
+
+            uint32_t currentGeneration = generation.load();
+            if (currentGeneration != cacheGeneration) {
+                cacheGeneration = currentGeneration;
+                std::fill(cache.begin(), cache.end(), CacheEntry{0, 0});
+            }
+
+            // Multiplicative hash of the whole address: the sets are even for any address pattern
+            CacheEntry* set = &cache[(((address * 0x9E3779B97F4A7C15ULL) >> 40) & cacheSetMask) * RPA_CACHE_WAYS];
+            for (uint8_t i = 0; i < RPA_CACHE_WAYS; i++) {
+                if ((set[i].address & ~REFERENCED) == address) {
+                    set[i].address |= REFERENCED;
+                    hits.store(hits.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                    return set[i].key;
+                }
+            }
+            misses.store(misses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+            uint64_t key = 0;
+            uint32_t prand = (address >> 24) & 0xFFFFFF;
+            uint32_t hash = address & 0xFFFFFF;
+            uint32_t operations = 0;
+
+            readers.fetch_add(1);
+            int8_t index = active.load();
+            if (index >= 0) {
+                const std::vector<IdentityResolvingKey> &keys = tables[index];
+                for (size_t i = 0; i < keys.size(); i++) {
+                    operations++;
+                    if (ah(keys[i].irk, prand) == hash) {
+                        key = keys[i].key;
+                        break;
+                    }
+                }
+            }
+            readers.fetch_sub(1);
+
+            aesOperations.store(aesOperations.load(std::memory_order_relaxed) + operations, std::memory_order_relaxed);
+            if (key != 0) {
+                resolved.store(resolved.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+
+            CacheEntry* victim = findVictim(set);
+            victim->address = address;
+            victim->key = key;
+            return key;
+        }
+
+        // Empty list switches the resolution off
+        void setKeys(const std::vector<IdentityResolvingKey> &keys) {
+            if (keys.empty()) {
+                active.store(-1);
+                generation.fetch_add(1);
+                return;
+            }
+
+            int8_t next = (active.load() == 0) ? 1 : 0;
+            // A reader which started before the last switch may still use the other list
+            while (readers.load() > 0) {
+                yield();
+            }
+            tables[next] = keys;
+            active.store(next);
+            generation.fetch_add(1);
+        }
+
+        size_t size() {
+            int8_t index = active.load();
+            return (index < 0) ? 0 : tables[index].size();
+        }
+
+        uint32_t getHits() { return hits.load(std::memory_order_relaxed); }
+        uint32_t getMisses() { return misses.load(std::memory_order_relaxed); }
+        uint32_t getResolved() { return resolved.load(std::memory_order_relaxed); }
+        uint32_t getAesOperations() { return aesOperations.load(std::memory_order_relaxed); }
+
+    private:
+        // Empty entry or the first one not used since the last pass (second chance), the passed ones lose their flag
+        CacheEntry* findVictim(CacheEntry* set) {
+            for (uint8_t i = 0; i < RPA_CACHE_WAYS; i++) {
+                if (set[i].address == 0) {
+                    return &set[i];
+                }
+            }
+            for (uint8_t pass = 0; pass < 2; pass++) {
+                for (uint8_t i = 0; i < RPA_CACHE_WAYS; i++) {
+                    if ((set[i].address & REFERENCED) == 0) {
+                        return &set[i];
+                    }
+                    set[i].address &= ~REFERENCED;
+                }
+            }
+            return &set[0];
+        }
+};
+
+#endif
@@ -0,0 +1,188 @@
+#ifndef SCANNER
+#define SCANNER
+
+#include "definitions.h"
+#include "utilities.cpp"
+#include "ringbuffer.cpp"
+#include "intake.cpp"
+#include "log.hpp"
+#include <ArduinoJson.h>
+#include <BLEDevice.h>
+#include <BLEUtils.h>
+#include <BLEScan.h>
+#include <BLEAdvertisedDevice.h>
+
+// Source of the advertisements for the presence logic
+class Scanner {
+    public:
+        virtual ~Scanner() {}
+
+        virtual void setup() {}
+
+        // Scan only if it is enabled (it makes no sense without network)
+        virtual void loop(boolean enabled) {}
+
+        // Next received advertisement. Returns false if there is no more for now.
+        virtual boolean next(Advertisement &advertisement) = 0;
+
+        // Only these devices are needed (observed only mode), empty list means every device
+        virtual void setFilter(const std::vector<uint64_t> &keys) {}
+
+        // Resolvable private addresses of these devices are reported with the key of the device
+        virtual void setIdentityResolvingKeys(const std::vector<IdentityResolvingKey> &keys) {}
+
+        // Device table limit, called before the first loop() (the scan is not running yet)
+        virtual void setCapacity(int devices) {}
+
+        virtual void fillStats(JsonObject stats) {}
+
+        // Number of the completed scan windows
+        virtual uint32_t getCycles() { return 0; }
+};
+
+// Scanner of the ESP32 radio
+class BleScanner: public Scanner, public BLEAdvertisedDeviceCallbacks {
+
+    Logger logger;
+    BLEScan* pBLEScan;
+
+    unsigned long lastRun = 0;
+    volatile boolean scanning = false; // Scan is running in the background (set back by the BLE task)
+    volatile uint32_t cycles = 0; // Completed scan windows (written by the BLE task only)
+    unsigned long scanAfter = BT_DEFAULT_SCAN_INTERVAL;
+
+    // onResult is called on the BLE task, it only puts the advertisements into this queue.
+    // Device state is changed and sent out on the Arduino task (loop()).
+    RingBuffer<Advertisement, BT_ADVERTISEMENT_QUEUE_SIZE> advertisements;
+    uint32_t reportedDrops = 0;
+
+    // Observed only mode: foreign advertisements are dropped at the very top of onResult
+    MacFilter filter;
+    std::atomic<uint32_t> filtered;
+
+    // Rotating private addresses are resolved before the filter
+    RpaResolver resolver;
+
+    // Scan complete callback is a plain function, it needs the object.
+    // Function local static: the source files are compiled one by one too, a static member definition would be duplicated.
+    static BleScanner*& instance() {
+        static BleScanner* scanner = NULL;
+        return scanner;
+    }
+
+    public:
+        BleScanner(Log& rlog) : logger(rlog, "[SCAN]"), filtered(0) {
+            instance() = this;
+        }
+
+        void setup() {
+            BLEDevice::init(BOARD_NAME);
+            pBLEScan = BLEDevice::getScan(); //create new scan
+            pBLEScan->setAdvertisedDeviceCallbacks(this);
+            pBLEScan->setActiveScan(true); //active scan uses more power, but get results faster
+            pBLEScan->setInterval(100);
+            pBLEScan->setWindow(99);  // less or equal setInterval value
+
+            logger << BOARD_NAME " is initiated";
+        }
+
+        void loop(boolean enabled) {
+            // Scan runs in the background in BT_SCAN_DURATION long windows, one after the other.
+            // Window end only clears the result cache of the BLE library, the other objects' loops are never blocked.
+            if (!scanning && millis() - lastRun > scanAfter) {
+                // Otherwise makes no sens to scan and sent it over
+                if (enabled) {
+                    pBLEScan->clearResults();   // delete results fromBLEScan buffer to release memory
+                    scanning = pBLEScan->start(BT_SCAN_DURATION, &BleScanner::scanComplete, false);
+                    lastRun = millis();
+                }
+            }
+
+            if (advertisements.getDropped() != reportedDrops) {
+                reportedDrops = advertisements.getDropped();
+                logger << "Advertisement queue is full, dropped advertisements: " << (String)reportedDrops << " High water mark: " << (String)advertisements.getHighWaterMark();
+            }
+        }
+
+        boolean next(Advertisement &advertisement) {
+            return advertisements.pop(advertisement);
+        }
+
+        void setFilter(const std::vector<uint64_t> &keys) {
+            filter.set(keys);
+        }
+
+        void setIdentityResolvingKeys(const std::vector<IdentityResolvingKey> &keys) {
+            resolver.setKeys(keys);
+        }
+
+        void setCapacity(int devices) {
+            resolver.setCacheSize(devices);
+        }
+
+        uint32_t getCycles() {
+            return cycles;
+        }
+
+        void fillStats(JsonObject stats) {
+            stats["queue_size"] = advertisements.capacity();
+            stats["queue_depth"] = advertisements.depth();
+            stats["queue_high_water_mark"] = advertisements.getHighWaterMark();
+            stats["queue_dropped"] = advertisements.getDropped();
+            stats["filter_size"] = filter.size();
+            stats["filtered"] = filtered.load(std::memory_order_relaxed);
+            if (resolver.size() > 0) {
+                stats["rpa_keys"] = resolver.size();
+                stats["rpa_cache_size"] = resolver.getCacheSize();
+                stats["rpa_cache_hits"] = resolver.getHits();
+                stats["rpa_cache_misses"] = resolver.getMisses();
+                stats["rpa_resolved"] = resolver.getResolved();
+                stats["rpa_aes_operations"] = resolver.getAesOperations();
+            }
+        }
+
+    private:
+
+        static void scanComplete(BLEScanResults results) {
+            instance() -> cycles = instance() -> cycles + 1;
+            instance() -> scanning = false;
+        }
+
+        // Runs on the BLE task: no device state change and no network I/O here, just enqueue
+        void onResult(BLEAdvertisedDevice advertisedDevice) {
+            // Serial.printf("Advertised Device: %s \n", advertisedDevice.toString().c_str());
+
+            uint64_t address = macToKey(*advertisedDevice.getAddress().getNative());
+            boolean randomAddress = advertisedDevice.getAddressType() == BLE_ADDR_TYPE_RANDOM;
+            // Beacon identity is read from the payload of the BLE library in place
+            uint8_t* payload = advertisedDevice.getPayload();
+            size_t payloadLength = advertisedDevice.getPayloadLength();
+            payloadLength = (payloadLength > BLE_PAYLOAD_LENGTH) ? BLE_PAYLOAD_LENGTH : payloadLength;
+
+            uint64_t key;
+            uint64_t identity;
+            if (!admitAdvertisement(resolver, filter, address, randomAddress, payload, payloadLength, key, identity)) {
+                filtered.store(filtered.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return;
+            }
+
+            Advertisement advertisement;
+            advertisement.mac = key;
+            advertisement.address = address;
+            advertisement.randomAddress = randomAddress;
+            advertisement.identity = identity;
+            advertisement.timestamp = millis();
+            advertisement.rssi = advertisedDevice.getRSSI();
+            advertisement.name[0] = '\0';
+            if (advertisedDevice.haveName()) {
+                strncpy(advertisement.name, advertisedDevice.getName().c_str(), DEVICE_NAME_LENGTH);
+                advertisement.name[DEVICE_NAME_LENGTH] = '\0';
+            }
+            advertisement.payloadLength = payloadLength;
+            memcpy(advertisement.payload, payload, payloadLength);
+
+            advertisements.push(advertisement);
+        }
+};
+
+#endif
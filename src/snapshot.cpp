@@ -0,0 +1,116 @@
+#ifndef SNAPSHOT
+#define SNAPSHOT
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "definitions.h"
+#include "utilities.cpp"
+
+// Batch publishing: one JSON document per scan cycle instead of one message per device and transition.
+// {"cycle":12,"changes":{"317234b9d2d0":"home","15172f81accc":"not_home"},"devices":{"317234b9d2d0":-67},"truncated":0}
+// changes: state changes since the last document (the latest state of a device wins)
+// devices: every available device with its RSSI (the whole state, a lost document is replaced by the next one)
+// truncated: entries which did not fit into the document
+// The document is built in a fixed buffer, there is no String per device.
+class Snapshot {
+
+    struct Change {
+        uint64_t key;
+        bool available;
+    };
+
+    Change changes[BATCH_MAX_CHANGES];
+    uint16_t changeCount = 0;
+
+    char buffer[BATCH_MAX_PAYLOAD + 1];
+    size_t length = 0;
+    boolean firstEntry = true;   // of the current object
+    uint16_t truncated = 0;
+
+    public:
+        // Returns false if the change list is full, the document should be published now
+        boolean addChange(uint64_t key, boolean available) {
+            for (uint16_t i = 0; i < changeCount; i++) {
+                if (changes[i].key == key) {
+                    changes[i].available = available;
+                    return true;
+                }
+            }
+            if (changeCount < BATCH_MAX_CHANGES) {
+                changes[changeCount++] = Change{key, available};
+            }
+            return changeCount < BATCH_MAX_CHANGES;
+        }
+
+        // Starts a new document with the collected changes (the change list is emptied).
+        // The presence payloads must be escaped already (see PresenceStrings::getJson()).
+        void begin(uint32_t cycle, const char* presentJson, const char* notPresentJson) {
+            length = 0;
+            truncated = 0;
+            firstEntry = true;
+
+            append("{\"cycle\":%u,\"changes\":{", cycle);
+            for (uint16_t i = 0; i < changeCount; i++) {
+                char mac[KEY_STRING_LENGTH + 1];
+                formatKey(changes[i].key, mac);
+                appendEntry("\"%s\":\"%s\"", mac, changes[i].available ? presentJson : notPresentJson);
+            }
+            changeCount = 0;
+            // Room is reserved by appendArgs()
+            length += snprintf(buffer + length, sizeof(buffer) - length, "},\"devices\":{");
+            firstEntry = true;
+        }
+
+        // Available device
+        void addDevice(uint64_t key, int rssi) {
+            char mac[KEY_STRING_LENGTH + 1];
+            formatKey(key, mac);
+            appendEntry("\"%s\":%d", mac, rssi);
+        }
+
+        // The document, valid till the next begin()
+        const char* finish() {
+            // Room is reserved by appendArgs()
+            length += snprintf(buffer + length, sizeof(buffer) - length, "},\"truncated\":%u}", truncated);
+            return buffer;
+        }
+
+    private:
+        // One "key":value pair of an object, the separator is added. It is left out (counted) if it does not fit.
+        void appendEntry(const char* format, ...) {
+            size_t start = length;
+            va_list args;
+            va_start(args, format);
+            boolean fits = (firstEntry || append(",")) && appendArgs(format, args);
+            va_end(args);
+            if (!fits) {
+                length = start;
+                buffer[length] = '\0';
+                truncated++;
+                return;
+            }
+            firstEntry = false;
+        }
+
+        boolean append(const char* format, ...) {
+            va_list args;
+            va_start(args, format);
+            boolean fits = appendArgs(format, args);
+            va_end(args);
+            return fits;
+        }
+
+        // Appends if the text fits (room for the closing part of the document is always kept), returns false otherwise
+        boolean appendArgs(const char* format, va_list args) {
+            size_t room = BATCH_MAX_PAYLOAD - BATCH_CLOSING_LENGTH - length;
+            int written = vsnprintf(buffer + length, room + 1, format, args);
+            if (written < 0 || (size_t) written > room) {
+                buffer[length] = '\0';
+                return false;
+            }
+            length += written;
+            return true;
+        }
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef TIMERWHEEL
+#define TIMERWHEEL
+
+#include <stdint.h>
+#include <vector>
+#include "utilities.cpp"
+
+#define TIMER_NONE 0xFFFF
+
+// Hashed timer wheel for the device deadlines.
+// The wheel has SLOTS buckets, RESOLUTION milliseconds each. A bucket holds the keys of the devices
+// which should be checked when the time of the bucket is reached. advance() visits only the due buckets,
+// so the cost of a loop() is proportional to the number of the expired entries and not to the number of the devices.
+// Deadlines further than SLOTS * RESOLUTION go around the wheel: the owner gets them early and schedules them again.
+//
+// Entries are not removed when a device is seen again (that would be the hot path), the owner
+// checks the real deadline in the callback and schedules again if needed (lazy rescheduling).
+// schedule() returns the bucket index, the owner stores it and ignores the callbacks from any other bucket (stale entries).
+template <uint16_t SLOTS, uint16_t RESOLUTION>
+class TimerWheel {
+
+    std::vector<uint64_t> buckets[SLOTS];
+    std::vector<uint64_t> processing;   // bucket under processing, callbacks may schedule into the same bucket
+    uint16_t nextSlot = 0;              // bucket of the next tick
+    uint32_t nextTick = 0;              // time of the next tick (millis)
+
+    public:
+        void start(uint32_t now) {
+            nextTick = now + RESOLUTION;
+        }
+
+        uint16_t schedule(uint64_t key, uint32_t deadline) {
+            int32_t delta = (int32_t) (deadline - nextTick);
+            uint32_t ticks = (delta <= 0) ? 0 : ((uint32_t) delta + RESOLUTION - 1) / RESOLUTION;
+            if (ticks >= SLOTS) {
+                ticks = SLOTS - 1;
+            }
+
+            uint16_t slot = (nextSlot + ticks) % SLOTS;
+            buckets[slot].push_back(key);
+            return slot;
+        }
+
+        // Call the callback(key, slot) for every entry of the buckets which time is reached
+        template <typename Handler>
+        void advance(uint32_t now, Handler callback) {
+            uint16_t processed = 0;
+            while (timeReached(now, nextTick)) {
+                uint16_t slot = nextSlot;
+                nextSlot = (nextSlot + 1) % SLOTS;
+                nextTick += RESOLUTION;
+
+                processing.swap(buckets[slot]);
+                for (size_t i = 0; i < processing.size(); i++) {
+                    callback(processing[i], slot);
+                }
+                processing.clear();
+
+                // The loop was blocked for a whole round, all of the buckets are processed, continue from now
+                if (++processed == SLOTS) {
+                    nextTick = now + RESOLUTION;
+                    break;
+                }
+            }
+        }
+};
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef TOPICBUFFER
+#define TOPICBUFFER
+
+#include <Arduino.h>
+#include "definitions.h"
+#include "utilities.cpp"
+
+// Full MQTT topics are built in place: the <base topic>/ prefix is copied once, only the device part is written
+// after it per message (no String per publish). The result is valid till the next call.
+class TopicBuffer {
+
+    char buffer[MQTT_TOPIC_LENGTH + 1];
+    size_t prefixLength = 0;        // 0: the base topic does not fit, the caller builds the topic itself
+
+    public:
+        void setBase(const String &baseTopic) {
+            prefixLength = 0;
+            if (baseTopic.length() + 1 < MQTT_TOPIC_LENGTH) {
+                memcpy(buffer, baseTopic.c_str(), baseTopic.length());
+                buffer[baseTopic.length()] = '/';
+                prefixLength = baseTopic.length() + 1;
+            }
+        }
+
+        // <base topic>/<device key>, NULL if it does not fit
+        const char* device(uint64_t key) {
+            if (prefixLength == 0 || prefixLength + KEY_STRING_LENGTH > MQTT_TOPIC_LENGTH) {
+                return NULL;
+            }
+            formatKey(key, buffer + prefixLength);
+            return buffer;
+        }
+
+        // <base topic>/<topic>, NULL if it does not fit
+        const char* append(const String &topic) {
+            if (prefixLength == 0 || prefixLength + topic.length() > MQTT_TOPIC_LENGTH) {
+                return NULL;
+            }
+            memcpy(buffer + prefixLength, topic.c_str(), topic.length() + 1);
+            return buffer;
+        }
+};
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef TRACE
+#define TRACE
+
+#include "definitions.h"
+#include "utilities.cpp"
+#include "traceformat.cpp"
+#include "database.cpp"
+#include "log.hpp"
+#include <WiFi.h>
+
+// Streams the received advertisements to a TCP listener in a compact binary format (see traceformat.cpp).
+// Example to collect a trace on a PC: nc -l 5000 > office.trace
+// The trace can be fed through the presence logic on the PC, see tools/replay.
+class TraceRecorder {
+
+    Logger logger;
+    WiFiClient client;
+    String host;
+    int port = 0;
+    boolean enabled = false;
+
+    uint8_t buffer[TRACE_BUFFER_SIZE];
+    size_t used = 0;
+    uint32_t lastTimestamp = 0;
+    unsigned long lastFlush = 0;
+    unsigned long lastConnect = 0;
+    uint32_t records = 0;
+    uint32_t dropped = 0;
+
+    public:
+        TraceRecorder(Log& rlog) : logger(rlog, "[TRACE]") {
+        }
+
+        void setup(Database &database) {
+            this -> host = database.getValueAsString(DB_TRACE_HOST);
+            this -> port = database.getValueAsInt(DB_TRACE_PORT);
+            this -> enabled = host.length() > 0 && port > 0;
+
+            if (enabled) {
+                logger << "Advertisement trace is sent to " << host << ":" << (String)port;
+            }
+        }
+
+        void loop(boolean networkConnected) {
+            if (!enabled || !networkConnected) {
+                return;
+            }
+
+            if (!client.connected()) {
+                if (millis() - lastConnect > TRACE_RECONNECT_INTERVAL) {
+                    lastConnect = millis();
+                    if (client.connect(host.c_str(), port, TRACE_CONNECT_TIMEOUT)) {
+                        logger << "Trace listener connected.";
+                        used = 0;
+                        lastTimestamp = 0;
+                        used = traceWriteHeader(buffer);
+                    }
+                }
+                return;
+            }
+
+            if (used > 0 && millis() - lastFlush > TRACE_FLUSH_INTERVAL) {
+                flush();
+            }
+        }
+
+        void record(const Advertisement &advertisement) {
+            if (!enabled || !client.connected()) {
+                return;
+            }
+
+            if (used + TRACE_RECORD_MAX_LENGTH > sizeof(buffer)) {
+                flush();
+            }
+
+            used += traceWriteRecord(buffer + used, advertisement, lastTimestamp);
+            lastTimestamp = advertisement.timestamp;
+            records++;
+        }
+
+        void fillStats(JsonObject stats) {
+            if (enabled) {
+                JsonObject trace = stats.createNestedObject("trace");
+                trace["connected"] = (boolean) client.connected();
+                trace["records"] = records;
+                trace["dropped_bytes"] = dropped;
+            }
+        }
+
+    private:
+        void flush() {
+            size_t written = client.write(buffer, used);
+            if (written != used) {
+                dropped += used - written;
+                logger << "Trace write failed, disconnect.";
+                client.stop();
+            }
+            used = 0;
+            lastFlush = millis();
+        }
+};
+
+#endif
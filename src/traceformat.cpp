@@ -0,0 +1,163 @@
+#ifndef TRACEFORMAT
+#define TRACEFORMAT
+
+#include <stdint.h>
+#include <string.h>
+#include "definitions.h"
+#include "utilities.cpp"
+
+// Binary advertisement trace, written by TraceRecorder (trace.cpp) and read by the host replay (tools/replay).
+//
+// Header:  "BLET" + format version (1 byte), written on every (re)connect of the recorder
+// Record:  tag (1 byte): TRACE_TAG_PUBLIC or TRACE_TAG_RANDOM, the type of the advertised address
+//          time since the previous record in milliseconds (unsigned LEB128, the first one after a header is the absolute millis())
+//          advertised address (6 bytes, first byte of the address first), before the private address resolution
+//          RSSI (1 byte, signed)
+//          name length (1 byte) + name
+//          payload length (1 byte) + raw advertisement payload
+// Every item starts with its tag byte ("B" of the header), the content of a record is never taken for a header.
+#define TRACE_HEADER_LENGTH 5
+#define TRACE_RECORD_MAX_LENGTH (1 + 5 + 6 + 1 + 1 + DEVICE_NAME_LENGTH + 1 + BLE_PAYLOAD_LENGTH)
+#define TRACE_TAG_HEADER 'B'
+#define TRACE_TAG_PUBLIC 'P'
+#define TRACE_TAG_RANDOM 'R'
+
+static inline size_t traceWriteHeader(uint8_t* buffer) {
+    const uint8_t header[TRACE_HEADER_LENGTH] = {'B', 'L', 'E', 'T', TRACE_FORMAT_VERSION};
+    memcpy(buffer, header, TRACE_HEADER_LENGTH);
+    return TRACE_HEADER_LENGTH;
+}
+
+// The buffer must have TRACE_RECORD_MAX_LENGTH bytes. Returns the length of the record.
+static inline size_t traceWriteRecord(uint8_t* buffer, const Advertisement &advertisement, uint32_t previousTimestamp) {
+    size_t used = 0;
+    buffer[used++] = advertisement.randomAddress ? TRACE_TAG_RANDOM : TRACE_TAG_PUBLIC;
+    uint32_t delta = advertisement.timestamp - previousTimestamp;
+    do {
+        uint8_t bits = delta & 0x7F;
+        delta >>= 7;
+        buffer[used++] = bits | ((delta > 0) ? 0x80 : 0);
+    } while (delta > 0);
+
+    for (int shift = 40; shift >= 0; shift -= 8) {
+        buffer[used++] = (advertisement.address >> shift) & 0xFF;
+    }
+    buffer[used++] = (uint8_t) advertisement.rssi;
+
+    uint8_t nameLength = strnlen(advertisement.name, DEVICE_NAME_LENGTH);
+    buffer[used++] = nameLength;
+    memcpy(buffer + used, advertisement.name, nameLength);
+    used += nameLength;
+
+    uint8_t payloadLength = (advertisement.payloadLength > BLE_PAYLOAD_LENGTH) ? BLE_PAYLOAD_LENGTH : advertisement.payloadLength;
+    buffer[used++] = payloadLength;
+    memcpy(buffer + used, advertisement.payload, payloadLength);
+    used += payloadLength;
+    return used;
+}
+
+// Reads the records of a trace in memory. A header in the middle of the data (reconnected recorder,
+// concatenated traces) restarts the time base.
+// The key of the device (mac) is the advertised address: the private address resolution and the beacon identity
+// are done by the reader (see admitAdvertisement()), like on the radio. The identity is left 0.
+class TraceReader {
+
+    const uint8_t* data;
+    size_t length;
+    size_t position = 0;
+    uint32_t timestamp = 0;
+    boolean valid = true;
+
+    public:
+        TraceReader(const uint8_t* data, size_t length) : data(data), length(length) {
+            valid = readHeader();
+        }
+
+        // False if the data does not start with a supported header
+        boolean isValid() {
+            return valid;
+        }
+
+        // Returns false at the end of the data or at a truncated record (the end of an interrupted recording)
+        boolean next(Advertisement &advertisement) {
+            if (!valid) {
+                return false;
+            }
+            while (position < length && data[position] == TRACE_TAG_HEADER) {
+                if (!readHeader()) {
+                    // Recorded by an other firmware version (or a truncated header)
+                    valid = false;
+                    return false;
+                }
+            }
+            if (position >= length) {
+                return false;
+            }
+            uint8_t tag = data[position++];
+            if (tag != TRACE_TAG_PUBLIC && tag != TRACE_TAG_RANDOM) {
+                // Not a trace (or a corrupt one), the rest can not be read
+                valid = false;
+                return false;
+            }
+
+            uint32_t delta = 0;
+            for (int shift = 0; ; shift += 7) {
+                if (position >= length || shift > 28) {
+                    return false;
+                }
+                uint8_t bits = data[position++];
+                delta |= (uint32_t) (bits & 0x7F) << shift;
+                if ((bits & 0x80) == 0) {
+                    break;
+                }
+            }
+
+            if (position + 6 + 1 + 1 > length) {
+                return false;
+            }
+            advertisement.address = 0;
+            for (int i = 0; i < 6; i++) {
+                advertisement.address = (advertisement.address << 8) | data[position++];
+            }
+            advertisement.mac = advertisement.address;
+            advertisement.randomAddress = tag == TRACE_TAG_RANDOM;
+            advertisement.rssi = (int8_t) data[position++];
+
+            uint8_t nameLength = data[position++];
+            if (nameLength > DEVICE_NAME_LENGTH || position + nameLength + 1 > length) {
+                return false;
+            }
+            memcpy(advertisement.name, data + position, nameLength);
+            advertisement.name[nameLength] = '\0';
+            position += nameLength;
+
+            uint8_t payloadLength = data[position++];
+            if (payloadLength > BLE_PAYLOAD_LENGTH || position + payloadLength > length) {
+                return false;
+            }
+            memcpy(advertisement.payload, data + position, payloadLength);
+            advertisement.payloadLength = payloadLength;
+            position += payloadLength;
+
+            timestamp += delta;
+            advertisement.timestamp = timestamp;
+            advertisement.identity = 0;
+            return true;
+        }
+
+    private:
+        boolean isHeader() {
+            return position + TRACE_HEADER_LENGTH <= length && memcmp(data + position, "BLET", 4) == 0;
+        }
+
+        boolean readHeader() {
+            if (!isHeader() || data[position + 4] != TRACE_FORMAT_VERSION) {
+                return false;
+            }
+            position += TRACE_HEADER_LENGTH;
+            timestamp = 0;
+            return true;
+        }
+};
+
+#endif
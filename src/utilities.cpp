@@ -1,44 +1,159 @@
 #include "Arduino.h"
-#include "database.cpp"
+#include "definitions.h"
 
 #ifndef STRUCTS
 #define STRUCTS
+#define LATENCY_NONE 0
+#define LATENCY_ARRIVAL 1
+#define LATENCY_DEPARTURE 2
+
 struct MQTTMessage {
   String topic;
   String payload;
   boolean retain;
   boolean individualTopic; // Control if we want to send an individual topic, or the device add the default prefix automatically (send device topic by default)
+  boolean coalesce = false;             // device state: only the latest one of the topic is kept in the outbound queue
+  // Presence latency measurement (state messages only)
+  uint8_t latencyPath = LATENCY_NONE;   // arrival or departure
+  uint32_t transitionTime = 0;          // micros() of the state change
+  uint32_t detectionLatency = 0;        // microseconds from the last advertisement to the state change
+};
+
+// Presence state of a device for the MQTT client (see Mqtt::sendState()). Plain data: it is copied by value
+// through the Signal, the topic and the payload are produced only at the write.
+struct StateMessage {
+  uint64_t key;
+  boolean available;
+  uint8_t latencyPath;
+  uint32_t transitionTime;
+  uint32_t detectionLatency;
 };
 
+// Received MQTT message. It points into the receive buffer of the Mqtt object, it is valid only during the callback.
+struct MQTTInboundMessage {
+  const char* topic;
+  char* payload;          // zero terminated, the receiver may modify it (in place parsing)
+  size_t length;
+};
+
+// Plain (trivially copyable) record, no heap allocation per device.
+// Text formats (MAC, RSSI) are produced only when the data is sent out.
 struct Device {
-    String name;
-    String rssi;
-    String mac;
-    boolean available;
+    uint64_t mac;                           // 48 bit address, see macToKey() or beacon identity key, see adparser.cpp
     // internal data
-    unsigned long lastSeen;
-    int mark;
-    boolean observed;
+    uint32_t lastSeen;                      // millis()
+    uint32_t stateSince;                    // millis() of the last available change
+    uint32_t interval;                      // estimated advertising interval (ms), see Presence::learnInterval()
+    char name[DEVICE_NAME_LENGTH + 1];      // advertised name (truncated), zero terminated
+    uint16_t timerSlot;                     // timer wheel bucket of the next check (TIMER_NONE if there is no check)
+    int16_t rssiFiltered;                   // smoothed RSSI, 1/16 dBm
+    int8_t rssi;                            // last received RSSI
+    int8_t mark;
+    uint8_t missRate;                       // estimated ratio of the missed advertisements, 1/256
+    uint8_t intervalSamples;                // number of the interval samples (max 255)
+    bool available : 1;
+    bool observed : 1;
+    bool filterReady : 1;                   // rssiFiltered has a value
+    bool suppressed : 1;                    // a state change is held back (signal too weak or dwell time)
+};
 
+// One received advertisement, BLE task -> Arduino task
+struct Advertisement {
+    uint64_t mac;                           // key of the device: 48 bit address (see macToKey()) or the resolved private address
+    uint64_t address;                       // advertised address, before the resolution (it is recorded in the trace)
+    boolean randomAddress;                  // address type of the advertised address
+    uint64_t identity;                      // beacon identity key (see adparser.cpp) or 0
+    uint32_t timestamp;                     // millis() at reception
+    int8_t rssi;
+    char name[DEVICE_NAME_LENGTH + 1];      // empty if the device did not advertise a name
+    uint8_t payloadLength;
+    uint8_t payload[BLE_PAYLOAD_LENGTH];    // raw advertisement (+ scan response) data
 };
 
-// Get the name of the presence string. This is not the state, just the name which will be sent over!!!
-static String getPresentString (Database &database, boolean presenceState) {
-    String presence = DEFAULT_NOT_PRESENT;
+// The only clock for the timeouts is millis(). It overflows after ~49 days, so
+// always compare by difference: millis() - since > interval, or use this for deadlines
+static inline boolean timeReached(uint32_t now, uint32_t deadline) {
+    return (int32_t) (now - deadline) >= 0;
+}
 
-    if (presenceState) {
-        presence = database.getValueAsString(DB_PRECENCE);
-        if (presence == "") {                    
-            presence = DEFAULT_PRESENT;
+// MAC address as an integer (48 bit), the first byte of the address is the most significant one
+static inline uint64_t macToKey(const uint8_t* address) {
+    uint64_t key = 0;
+    for (int i = 0; i < 6; i++) {
+        key = (key << 8) | address[i];
+    }
+    return key;
+}
+
+// Parse a MAC address string with or without ":" separators (317234b9d2d0 or 31:72:34:b9:d2:d0)
+// Returns false if the string is not a valid address
+static inline boolean parseMac(const char* mac, uint64_t &key) {
+    int digits = 0;
+    key = 0;
+    for (const char* c = mac; *c != '\0'; c++) {
+        if (*c == ':') {
+            continue;
         }
+        if (!isHexadecimalDigit(*c) || digits == 12) {
+            return false;
+        }
+        key = (key << 4) | (uint64_t) ((*c <= '9') ? (*c - '0') : ((*c | 0x20) - 'a' + 10));
+        digits++;
+    }
+    return digits == 12;
+}
+
+// Beacon identity keys (see adparser.cpp) have the top bit set, MAC keys are 48 bit
+#define IDENTITY_KEY_FLAG 0x8000000000000000ULL
+
+static inline boolean isIdentityKey(uint64_t key) {
+    return (key & IDENTITY_KEY_FLAG) != 0;
+}
+
+// Longest key text: beacon identity key (a MAC address is 12 digits)
+#define KEY_STRING_LENGTH 16
+
+// Lowercase hex format without separators, this is the format what the MQTT topics use
+// (12 digits for a MAC address, 16 digits for a beacon identity key). No allocation.
+static inline void formatKey(uint64_t key, char buffer[KEY_STRING_LENGTH + 1]) {
+    if (isIdentityKey(key)) {
+        snprintf(buffer, KEY_STRING_LENGTH + 1, "%08x%08x", (unsigned int) (key >> 32), (unsigned int) (key & 0xFFFFFFFF));
     } else {
-        presence = database.getValueAsString(DB_NO_PRECENCE);
-        if (presence == "") {                    
-            presence = DEFAULT_NOT_PRESENT;
-        }                
+        snprintf(buffer, KEY_STRING_LENGTH + 1, "%04x%08x", (unsigned int) ((key >> 32) & 0xFFFF), (unsigned int) (key & 0xFFFFFFFF));
     }
+}
 
-    return presence;
+static inline String keyToMac(uint64_t key) {
+    char mac[KEY_STRING_LENGTH + 1];
+    formatKey(key, mac);
+    return String(mac);
+}
+
+// Escaped text can be this long (every character as \u00XX)
+#define JSON_ESCAPED_LENGTH(length) ((length) * 6)
+
+// Text as the content of a JSON string: " and \ are escaped, the control characters are written as \u00XX.
+// It is truncated at a whole character if it does not fit. Returns the length. No allocation.
+static inline size_t jsonEscape(const char* text, char* buffer, size_t size) {
+    size_t used = 0;
+    for (; *text != '\0'; text++) {
+        char escaped[7] = {*text, '\0'};
+        size_t length = 1;
+        if (*text == '"' || *text == '\\') {
+            escaped[0] = '\\';
+            escaped[1] = *text;
+            length = 2;
+        } else if ((uint8_t) *text < 0x20) {
+            length = snprintf(escaped, sizeof(escaped), "\\u%04x", (uint8_t) *text);
+        }
+        if (used + length >= size) {
+            break;
+        }
+        memcpy(buffer + used, escaped, length);
+        used += length;
+    }
+    buffer[used] = '\0';
+    return used;
 }
 
 #endif
\ No newline at end of file
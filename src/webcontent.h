@@ -2,1588 +2,363 @@
 
 // /functions.js
 const char* const data_functions_js_path PROGMEM = "/functions.js";
-const char data_functions_js[] PROGMEM = R"=====(
-// Must be a flat json object
-let boardData = {};
-let ajax = {};
-let timer;
-let boardname;
-let resetconfig = false;
-let advancedNetwork = false;
-let rebootCheck;
-let BOARD_NAME = "blecker";
-// AJAX service
-ajax.x = function () {
-if (typeof XMLHttpRequest !== 'undefined') {
-return new XMLHttpRequest();
-}
-var versions = [
-"MSXML2.XmlHttp.6.0",
-"MSXML2.XmlHttp.5.0",
-"MSXML2.XmlHttp.4.0",
-"MSXML2.XmlHttp.3.0",
-"MSXML2.XmlHttp.2.0",
-"Microsoft.XmlHttp"
-];
-var xhr;
-for (var i = 0; i < versions.length; i++) {
-try {
-xhr = new ActiveXObject(versions[i]);
-break;
-} catch (e) {
-}
-}
-return xhr;
+const char* const data_functions_js_etag PROGMEM = "\"ce7b3c2b009f3ef8\"";
+const size_t data_functions_js_len = 2542;
+const uint8_t data_functions_js[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x5a,0x6d,0x6f,0xdb,0x38,0x12,0xfe,0xee,0x5f,0xc1,0xe8,0x43,0x25,0x5d,0x6d,0x25,0xcd,0xf6,0x16,0xb8,0xba,
+0xe9,0x22,0x6d,0xd3,0x4b,0x0e,0x4d,0x52,0x34,0x29,0xae,0x40,0x1a,0x14,0xb4,0x44,0xdb,0x4a,0x64,0x4a,0x2b,0x52,0x4e,0x7c,0x59,0xff,0xf7,0x9b,0xe1,0x8b,0x5e,0x6c,
+0x4b,0xb1,0xf7,0xee,0x80,0x6b,0x80,0x44,0x22,0xe7,0x8d,0x33,0x0f,0x87,0xc3,0x51,0x13,0x26,0xc9,0x28,0xa5,0x79,0xf4,0x91,0x4a,0x4a,0x8e,0xc8,0xd3,0x72,0xd8,0x4b,
+0x60,0x8c,0xde,0xd1,0xc7,0xda,0xab,0x8c,0x67,0x2c,0xd7,0x8f,0x8a,0x9a,0xd3,0x19,0xd3,0xaf,0x39,0x13,0x4c,0x86,0x29,0x1f,0xc7,0x13,0xa0,0x1f,0xd3,0x44,0x98,0x09,
+0x1a,0xcd,0x29,0x0f,0x59,0x74,0xc1,0xe4,0x43,0x9a,0xdf,0x37,0x27,0x73,0x36,0x4a,0x53,0xf9,0x61,0xca,0xc2,0x7b,0x3d,0xf0,0xfe,0xf2,0xf8,0xeb,0xc7,0x9f,0x17,0xc7,
+0xe7,0x27,0x40,0xe8,0x8c,0x12,0x98,0x60,0xb9,0x33,0xec,0xa1,0x1d,0x01,0x5a,0x32,0x2e,0x78,0x28,0xe3,0x94,0x13,0xcf,0x27,0x4f,0xbd,0x78,0x4c,0x3c,0xb9,0xc8,0x58,
+0x3a,0x26,0xdf,0xcf,0x3f,0x9f,0x4a,0x99,0x7d,0x65,0xbf,0x17,0x4c,0x48,0xb2,0x77,0x74,0x44,0xdc,0x82,0x47,0x6c,0x1c,0x73,0x16,0xb9,0x48,0x9c,0x33,0x59,0xe4,0x9c,
+0x70,0xf6,0xb0,0x42,0xec,0xf9,0xc3,0xde,0xb2,0x37,0xa7,0x39,0x99,0xb3,0x5c,0x80,0x70,0x01,0x8a,0x6e,0x7a,0xce,0xf9,0x15,0xd0,0x1d,0x06,0xdf,0x67,0x09,0x12,0x07,
+0xbf,0x06,0x07,0x4e,0x7f,0x6d,0xf4,0xaf,0x1b,0x47,0x5f,0x6f,0x1c,0xfd,0x65,0xe3,0xe8,0xa1,0x19,0x8d,0xc3,0x3c,0x15,0xe9,0x58,0xda,0x09,0xa7,0x77,0x3b,0x54,0x56,
+0x3d,0x4e,0xc1,0xe7,0xe3,0x34,0x27,0x1e,0xbe,0xc5,0x60,0xdc,0xc1,0x10,0xfe,0xbc,0x2d,0xcd,0x0d,0x12,0xc6,0x27,0x72,0x0a,0x83,0x2f,0x5f,0xe2,0x4a,0x65,0xbe,0x80,
+0xdf,0xc0,0x06,0xa4,0xb8,0xdc,0x63,0x70,0xd9,0x9c,0x7d,0xbf,0x1c,0xdd,0xb1,0x50,0x7a,0x96,0xeb,0x26,0xbe,0x85,0x85,0x8f,0x72,0x46,0xc1,0xf9,0x4b,0x12,0x52,0x19,
+0x4e,0x89,0xc7,0x50,0xc0,0x12,0x7e,0x8c,0xbb,0x94,0xf2,0xa5,0x89,0x80,0x60,0x3c,0x6a,0x04,0xa1,0xc8,0x93,0x3e,0x70,0x26,0xc9,0x88,0x86,0xf7,0x7d,0x32,0x63,0x72,
+0x9a,0x46,0x7d,0x12,0x01,0x8a,0xfa,0x84,0x8a,0x05,0x0f,0x6d,0x98,0xd4,0x0b,0x39,0x82,0xb0,0x94,0x51,0xc1,0x29,0x33,0x4c,0x64,0x5e,0x30,0x1b,0x05,0x8c,0xb3,0x0e,
+0x38,0x46,0xe6,0x31,0x48,0x33,0xc6,0x3d,0x2b,0x5a,0x69,0xd4,0x92,0xd5,0x1c,0x07,0xfb,0xa3,0x85,0x90,0x54,0xb2,0x70,0x4a,0xf9,0x84,0x6d,0x04,0xc9,0x63,0xa0,0xc8,
+0xae,0x90,0x0c,0x8c,0x20,0xaf,0x71,0xc2,0xda,0xad,0x66,0x45,0x06,0x2e,0x61,0xd7,0xec,0x51,0xf6,0x09,0x2c,0x14,0x08,0x0b,0xe1,0xa3,0x23,0x86,0x4a,0x80,0x56,0x8f,
+0xac,0xee,0x97,0xcb,0xab,0x6b,0x05,0x28,0xf4,0x87,0x34,0x18,0x3a,0x05,0xf1,0x2c,0xf7,0xdc,0x0f,0x29,0x97,0x8c,0xcb,0x01,0xa2,0xd2,0xed,0x13,0x97,0x66,0x59,0x12,
+0x83,0x6b,0xc1,0x9a,0xfd,0xc7,0xc1,0xc3,0xc3,0xc3,0x00,0x02,0x39,0x1b,0xc0,0x2a,0x18,0x0f,0xd3,0x08,0xa1,0x89,0xcb,0xd6,0xae,0xf5,0xd0,0x6f,0x7e,0xe9,0xed,0x09,
+0x6c,0x88,0x35,0x67,0x6b,0xd7,0x56,0x2e,0x2f,0x9d,0x8c,0x9e,0x03,0x53,0x20,0xf4,0x00,0xde,0xdb,0x1a,0x60,0xee,0xd9,0x82,0xc4,0x5c,0x31,0x22,0x9d,0xa2,0x09,0xb2,
+0x42,0x4c,0x3d,0x9c,0x79,0x49,0xdc,0x23,0x17,0x7e,0xe3,0xf4,0x0d,0x0c,0xdc,0x2a,0x7b,0xca,0x68,0xa3,0x52,0x98,0xf5,0x34,0x97,0xc6,0x19,0xf9,0x8d,0xb8,0xbf,0x21,
+0x8f,0x1e,0xbc,0x4b,0x63,0xee,0xb9,0x2f,0xc0,0x25,0x6f,0x88,0xeb,0xfa,0x75,0xe3,0xdc,0xbf,0x9f,0x5c,0x83,0x17,0x78,0x91,0x94,0x41,0x2b,0x57,0x97,0xa5,0xe2,0xff,
+0x63,0x79,0x0d,0x83,0x55,0x70,0xfb,0xab,0x2b,0xab,0x1b,0x5f,0x1a,0x2c,0x8a,0x2c,0x4b,0x73,0x79,0x0c,0xb2,0xbe,0x65,0x49,0x4a,0xa3,0x7f,0xc6,0x72,0xfa,0x25,0x4f,
+0x27,0x00,0x26,0xe1,0xd5,0x32,0x8e,0x21,0xfc,0x14,0x27,0xec,0xf8,0xcb,0x19,0xcc,0xbc,0x78,0xb1,0xce,0x6c,0x19,0x4f,0xe6,0x00,0x1f,0xd1,0x20,0xfa,0x04,0x88,0xc1,
+0xbc,0x8c,0xbb,0x61,0x55,0x7b,0x25,0x54,0xbb,0x68,0x8c,0xe9,0x21,0x4a,0xc3,0x62,0x06,0x62,0x82,0x10,0x50,0x2f,0xd9,0x49,0xc2,0xf0,0xcd,0x73,0xcf,0x2e,0xbe,0x7c,
+0xbb,0x46,0xc0,0x8d,0xe3,0x00,0x01,0x0a,0xa4,0xee,0x18,0x04,0xb8,0x43,0x6b,0xaa,0x7a,0x15,0x2e,0x3a,0x74,0x1c,0x0f,0xbb,0x97,0xbb,0x66,0xf1,0x93,0xcd,0x56,0x26,
+0xed,0xac,0x67,0x59,0xa3,0x65,0x6f,0x0f,0x76,0x24,0x90,0xc1,0x12,0x3d,0xb7,0x50,0xc2,0x94,0x4a,0x18,0xf3,0xf5,0x60,0xca,0x33,0x23,0xdd,0x4e,0x04,0x9a,0xce,0xf7,
+0x37,0x5a,0x55,0xb9,0xa8,0x72,0x3b,0x68,0x79,0x88,0x79,0x94,0x3e,0x04,0x76,0x76,0xa8,0x12,0x5b,0xc9,0x1b,0xf3,0x58,0x7e,0x02,0x68,0xe2,0x74,0xb5,0xac,0xca,0x95,
+0x30,0x5c,0x77,0x26,0x6c,0x47,0xe3,0xc9,0xf7,0x8b,0xb3,0xc8,0x73,0xd5,0x46,0x8e,0xd5,0x06,0xc6,0x47,0x48,0x45,0xa2,0x18,0xcd,0xe2,0x3a,0xa8,0x1b,0xb2,0xcc,0xd1,
+0x8a,0x9e,0x29,0xcd,0xc5,0x71,0x5f,0x67,0x79,0xaa,0x8d,0x3a,0x52,0xb4,0xa8,0xec,0x58,0xca,0x3c,0x1e,0x15,0x92,0x79,0xae,0x9e,0x43,0x4d,0x08,0xda,0xef,0xa7,0xd6,
+0xa5,0x56,0x6c,0xdf,0x70,0x57,0x2e,0x36,0x87,0xec,0xfa,0x7a,0x21,0xbe,0x97,0x3c,0x59,0x6c,0x58,0xaf,0x76,0xf0,0x7b,0xc9,0xbb,0x16,0xad,0x89,0x06,0x60,0x96,0x4c,
+0xb9,0x59,0x7d,0xc9,0x08,0x2e,0x08,0x21,0xdb,0xdd,0x37,0xb6,0x35,0x9b,0xcb,0xe7,0xbc,0xb0,0xea,0x01,0x77,0xbf,0xc8,0x26,0x39,0x24,0x54,0x77,0x68,0x40,0x9d,0xb0,
+0x33,0x9e,0x15,0xb2,0x33,0x1c,0x40,0x64,0x0c,0xb2,0x3c,0x68,0x87,0x65,0x0d,0x14,0xb2,0x6f,0x0e,0x74,0xea,0x50,0x7a,0x03,0x48,0xce,0x98,0x03,0xdc,0xb4,0xc8,0x07,
+0x6a,0x1f,0xf4,0x15,0x3d,0x48,0x00,0xe1,0x67,0x92,0xcd,0x3c,0x27,0x2c,0x84,0x4c,0x67,0x6a,0x76,0xa0,0xd7,0xe9,0xf8,0x70,0x3a,0x2c,0x12,0x16,0x44,0xb1,0xc8,0x12,
+0x8a,0xf9,0xc8,0xe1,0x29,0x67,0x4e,0xdd,0x11,0x6d,0x14,0xcf,0x86,0xaf,0x11,0xb0,0x36,0xea,0x22,0x8f,0xb7,0xd9,0x6d,0xd5,0xae,0x09,0x68,0x14,0xa9,0x6d,0xfa,0x39,
+0x16,0x70,0x3c,0xe1,0x41,0x85,0xc3,0x70,0xca,0xe5,0x12,0x16,0x9d,0xf2,0xf2,0xed,0x94,0xf2,0x28,0x61,0x79,0x5f,0x03,0xe8,0x39,0x21,0xe5,0x26,0x45,0x19,0xf6,0x65,
+0x37,0x11,0x6a,0xf3,0x5b,0x13,0x36,0xb2,0xae,0xf3,0xac,0x1e,0xf9,0x8a,0x7f,0x75,0x70,0xa3,0x2c,0x55,0x4a,0xd8,0x24,0x0f,0x6e,0xec,0xab,0xc2,0xc3,0x4c,0xaa,0x03,
+0xc1,0x7a,0x59,0xc5,0xa2,0x8c,0xc4,0xba,0x87,0xea,0xb8,0x8e,0xe2,0xf9,0x16,0x7b,0x46,0xd7,0x14,0x88,0x4f,0xa0,0x0f,0x62,0x0e,0x4b,0x39,0xbd,0x3e,0xff,0x8c,0x78,
+0xd7,0x3b,0x91,0x28,0xf9,0x2c,0x0a,0x0c,0xec,0x71,0x8c,0x61,0x78,0x4b,0x34,0xea,0x11,0x07,0x44,0xe8,0xa7,0x75,0x9c,0x8d,0x92,0x34,0xbc,0x77,0x30,0x0d,0x94,0x95,
+0x35,0x0c,0x43,0x9d,0x72,0x06,0x75,0x49,0x3e,0xa7,0x89,0x97,0xc5,0x7c,0xd2,0x27,0xbf,0x1e,0xc0,0xbf,0x4d,0x6b,0xfc,0x2f,0x2c,0xaf,0x21,0x73,0x05,0x15,0x3b,0xc8,
+0x2d,0xc1,0x65,0x76,0x74,0xc6,0xf2,0x10,0x26,0x81,0x05,0x64,0x04,0xca,0x01,0xd1,0x3e,0x3e,0xca,0x54,0xd2,0xe4,0x2f,0xaf,0x0e,0x0e,0x56,0x54,0xb7,0x20,0xa2,0x6e,
+0x82,0x36,0x1a,0x50,0xa0,0xea,0xbe,0xaa,0x46,0x1c,0x9a,0x1a,0xba,0x5e,0x35,0x2a,0xb5,0x10,0x21,0xb0,0x33,0x68,0x50,0x02,0xef,0xea,0x6c,0x55,0x4d,0xc2,0x9e,0x57,
+0x3a,0x9a,0x14,0x7a,0x0c,0xed,0x55,0x65,0xb7,0xae,0xba,0x75,0xea,0xc6,0x41,0xac,0x38,0x57,0x0a,0x56,0x55,0x0f,0x18,0x49,0x80,0x98,0xc3,0x83,0x03,0x17,0x87,0x5a,
+0xb4,0x36,0xd7,0xb7,0x53,0xf4,0xf4,0x53,0x0d,0x9f,0x2f,0x41,0xdd,0x5b,0xac,0xa1,0xdc,0x51,0xfe,0xee,0xaa,0x08,0x43,0x88,0xc9,0x9e,0xbb,0x92,0xaa,0xc2,0x84,0xd1,
+0x5c,0xdf,0xff,0xca,0xa2,0xbb,0x84,0xad,0xba,0x1c,0x42,0xde,0x0c,0x11,0x8e,0xba,0xee,0x6f,0xde,0x17,0x75,0xf5,0xdf,0xa4,0xd7,0x47,0xcc,0x86,0x6c,0xeb,0x2a,0x8c,
+0xbb,0x35,0x7a,0x41,0xe7,0xac,0x9d,0x1c,0x53,0x2f,0x9a,0x4b,0x18,0xe4,0x81,0x35,0xd5,0xe6,0xa0,0xdc,0x56,0xb7,0x11,0xb6,0xa5,0x6a,0x6b,0x69,0xc3,0x55,0xf6,0x46,
+0x5c,0xfa,0x69,0x6f,0xe5,0x8e,0x8c,0xe3,0xa5,0x02,0xae,0xc7,0x66,0x69,0xce,0x7e,0x66,0x68,0x1c,0x10,0x6e,0xe5,0x94,0x3a,0xa3,0x8e,0xe9,0xce,0x6c,0x11,0x9b,0xc7,
+0x21,0x8b,0xa3,0x9d,0x19,0x01,0xc9,0x34,0xe6,0x3b,0xb3,0xc1,0x29,0x2b,0x31,0xbd,0xed,0xc8,0x86,0x5d,0x89,0xb4,0x90,0x3b,0xf3,0xcd,0xe8,0xa3,0x5e,0xe1,0xee,0x9e,
+0x19,0x31,0x0a,0x08,0xfa,0x13,0x9e,0x19,0x17,0x78,0xf7,0xde,0x5d,0x1f,0x66,0x89,0xad,0xb8,0x2c,0x96,0x38,0x93,0xdb,0xe0,0x77,0x44,0x45,0x1c,0xb6,0xd0,0x5a,0xd9,
+0xeb,0x2d,0x1c,0x73,0x5b,0xb7,0x3b,0x6a,0x67,0xb0,0xae,0x5a,0xb1,0x1d,0x56,0xbb,0xb8,0xba,0xa0,0xda,0xc5,0xd7,0x8e,0xd4,0x2e,0xae,0x76,0xa0,0x76,0x71,0x75,0xe0,
+0xb4,0x8b,0xad,0x1b,0xa6,0x5d,0x9c,0x5d,0x28,0xed,0x5c,0x5e,0x2b,0x48,0x3b,0xb5,0xb5,0x61,0x74,0x95,0xe9,0x19,0x88,0xae,0x41,0xba,0x0b,0xa3,0x46,0x76,0x6b,0x97,
+0xb1,0x59,0x4f,0x43,0xb2,0xf6,0xfc,0x27,0x73,0xbc,0x96,0xa7,0x00,0xe6,0xdb,0x46,0xf3,0xb3,0x87,0x7d,0xcd,0x37,0x55,0x8b,0x13,0xa5,0x58,0xac,0xe3,0xa9,0xaa,0x13,
+0x7e,0xbd,0x30,0xab,0x1f,0x03,0xff,0x79,0xf1,0xa6,0x25,0xb5,0x5e,0x22,0x42,0x24,0x8b,0xb4,0xad,0x61,0x9a,0x24,0x2c,0x94,0xf6,0x1a,0x55,0x4e,0x05,0x68,0x37,0xcc,
+0xd7,0xda,0xb4,0xba,0xb9,0x76,0x27,0x94,0xe5,0xff,0xb8,0xba,0xbc,0x00,0x05,0x39,0x14,0x83,0xf1,0x78,0xe1,0x95,0x7c,0x7e,0xad,0x3b,0xe3,0x39,0xfb,0xb8,0x2e,0x1c,
+0x76,0xfa,0xe4,0x49,0x69,0x7c,0xa3,0x04,0x2c,0xfb,0xb5,0x2b,0xee,0xd3,0xd2,0x7f,0xbe,0xde,0x3c,0x5c,0xaf,0x37,0x71,0x02,0xa3,0x61,0x7b,0x5d,0xa0,0x0e,0xd5,0xd4,
+0x65,0xdb,0x92,0xa6,0x6f,0x0a,0x19,0x15,0x3b,0xaf,0x2a,0x83,0x40,0xaa,0x6a,0xe4,0x61,0xf1,0x51,0x2a,0xac,0x99,0x62,0x62,0xf1,0xbf,0x8a,0x97,0x89,0x07,0xc2,0x49,
+0x0b,0x53,0x48,0x6a,0x09,0x9e,0x0d,0xee,0xb2,0x67,0xba,0x12,0xf0,0xae,0xfa,0x82,0xc1,0x34,0x67,0x63,0xa4,0xd8,0x57,0xb3,0xcb,0xa6,0x97,0x60,0x45,0x31,0x78,0x9e,
+0xe1,0xf2,0x26,0x50,0xbc,0xc6,0x78,0x99,0xf5,0x35,0x0e,0x61,0xae,0xc0,0x20,0xab,0xb1,0x40,0xbd,0x69,0x6b,0xcc,0xc4,0x11,0xc9,0x68,0x2e,0x90,0x55,0x8f,0xa8,0xe6,
+0xca,0x9e,0x7a,0x84,0xfa,0x2e,0x4c,0x8a,0x88,0x09,0xcf,0x21,0xce,0xe6,0xf1,0xc0,0xf1,0x1b,0x55,0xa9,0xdd,0x01,0x35,0x6d,0x68,0xb5,0x33,0xac,0x15,0xae,0xf5,0x8a,
+0xb0,0x42,0x26,0xf1,0xfc,0xed,0x5a,0x2a,0x08,0x31,0xa4,0xc1,0x3a,0x14,0xf6,0xa6,0x90,0x7a,0x89,0xc2,0x7c,0x82,0xd0,0x43,0x4a,0xbf,0xb0,0x8d,0x12,0xa6,0xf9,0x85,
+0xe9,0x08,0xe2,0x47,0x84,0x5a,0x87,0x5c,0xd3,0xae,0xf6,0xc7,0xd1,0x45,0x7a,0xe6,0x26,0xbe,0x55,0x3b,0x45,0xd7,0xcb,0xa8,0xea,0xa6,0x39,0x71,0x8b,0x75,0xbb,0xea,
+0xd4,0x7e,0xfb,0x7a,0xf6,0x21,0x9d,0x01,0x1c,0xb1,0x95,0x56,0x11,0x69,0xc7,0x0e,0xeb,0x2d,0x73,0x2d,0xa8,0x11,0x45,0x38,0x30,0x92,0xb2,0x3f,0xa5,0xfb,0xf0,0x01,
+0xc8,0xc9,0x63,0x70,0x74,0x99,0x7a,0xfc,0x00,0x96,0x70,0x42,0xe1,0x3a,0xe0,0x61,0xab,0xb2,0xaf,0x05,0xdd,0xfa,0xe4,0xe8,0xdd,0x4a,0x45,0x0d,0xb3,0x7e,0xbd,0x4a,
+0xc4,0xf7,0x32,0x22,0x06,0x07,0x6b,0x48,0xca,0x68,0xe4,0x21,0x42,0x89,0x31,0xd3,0x73,0x0e,0x1c,0xa8,0xea,0x39,0x64,0xd5,0x04,0x4e,0x17,0x6f,0x70,0xe8,0x0f,0x49,
+0x8d,0xde,0x0a,0x8f,0xa3,0x5a,0x53,0xad,0x2d,0x74,0x40,0xd4,0x50,0x06,0xd3,0xe5,0x7a,0xcb,0x0d,0xee,0xee,0x63,0x80,0xdd,0x96,0x4d,0x6e,0x23,0x53,0x7f,0xaf,0xa7,
+0x65,0x95,0xb2,0x14,0xa0,0x2b,0x92,0x61,0xaf,0x4c,0x70,0x36,0xd9,0x7d,0xb4,0xd9,0x0f,0xdb,0x9c,0xd6,0xeb,0x35,0xf8,0x22,0x88,0x52,0xd8,0x9a,0x49,0x3a,0xf1,0x9c,
+0xaf,0x46,0x10,0x79,0xa0,0x82,0xb0,0x59,0x26,0x17,0x81,0xe3,0x6f,0xf0,0x1d,0x66,0x80,0x0f,0x57,0x57,0x5e,0x28,0xc4,0x05,0xc2,0xe5,0xa9,0xb7,0xc1,0x11,0xe2,0xfd,
+0xe2,0x9a,0x4e,0x70,0xde,0x73,0xa6,0x0c,0x3b,0x45,0x37,0x07,0xb7,0xb0,0xa1,0x04,0xcb,0xe5,0x71,0x74,0x47,0xf1,0xf6,0x8a,0x37,0x2a,0xaf,0xe7,0x8c,0x18,0x84,0x9a,
+0x31,0x1e,0xe1,0x97,0x9f,0xb7,0x49,0xcc,0xef,0x21,0x2a,0xc9,0xd1,0x0f,0x47,0xa5,0x0d,0x31,0x65,0x4c,0xfe,0x70,0x08,0x26,0x06,0x18,0xc3,0x28,0x19,0xc5,0xf0,0xe4,
+0xc0,0xc4,0xfe,0x3b,0xa7,0xfc,0x66,0x35,0x4b,0x23,0x9a,0x74,0x6c,0x2a,0x67,0xb6,0x38,0x47,0x12,0x9b,0xe8,0x46,0x9d,0x0d,0x3e,0x7b,0x57,0xd3,0xb4,0x22,0xa3,0x2d,
+0xc4,0xb0,0xd6,0x0f,0x09,0xd5,0x46,0x79,0x0e,0x1c,0x1f,0x82,0xa9,0xe5,0x9a,0xaf,0x25,0xca,0x26,0x48,0x2a,0xa8,0x0c,0x2f,0xae,0x20,0x47,0x85,0x73,0x63,0x8f,0x50,
+0x81,0x44,0xb1,0x74,0x65,0x4d,0x94,0xb1,0x23,0xb3,0xc9,0xcf,0x65,0xc6,0xdd,0xc0,0xcd,0xb0,0xb3,0x64,0x91,0xa7,0x5e,0xcc,0x75,0x1a,0xb3,0xa7,0x12,0xbb,0x8d,0x7c,
+0xfc,0x01,0xb7,0x5d,0xeb,0x02,0xcf,0x6b,0xd8,0x86,0x82,0xcb,0x54,0x9f,0x51,0x39,0xd5,0x60,0x55,0xf9,0x9e,0xfc,0xf1,0x07,0x59,0x9b,0xab,0xa5,0xe0,0x31,0x83,0x93,
+0x2e,0xc7,0xc2,0xcf,0xec,0xf6,0x12,0xcd,0x3d,0xd8,0x41,0xbf,0xa8,0x13,0xb5,0x4d,0xaf,0x85,0xac,0xbb,0xcf,0x21,0x4f,0xc2,0x29,0xf2,0x2f,0x16,0x84,0xba,0x9b,0xb2,
+0x54,0xfd,0x9f,0xad,0x78,0xc5,0x3d,0x24,0x58,0x3c,0xcf,0x2a,0xd6,0xbf,0x6d,0xcb,0xaa,0xdc,0x55,0xf1,0xbd,0x3a,0x54,0x8c,0xe8,0x8f,0x4d,0x27,0x60,0x6d,0xd9,0x45,
+0x86,0x27,0x9e,0xb3,0xf9,0x43,0x49,0xf3,0x2b,0x8b,0x6d,0x74,0xf0,0x54,0x42,0x0e,0xeb,0x3a,0x5b,0x8c,0xa0,0x81,0xa6,0x44,0x9b,0xda,0xfa,0xff,0x66,0x66,0x43,0xa7,
+0x7c,0x35,0xc5,0x21,0x8d,0xd7,0xb8,0xae,0x9b,0x2e,0x34,0x36,0x3b,0x10,0x6a,0x9b,0x59,0xd4,0xa6,0x49,0x47,0x77,0xd5,0x47,0x1b,0xd5,0xab,0x86,0x11,0x7b,0x88,0xdb,
+0xd1,0x0b,0x9d,0xd8,0xf0,0x31,0x00,0xd8,0xc5,0x50,0x24,0xfd,0xf8,0xe1,0xa8,0x2f,0x38,0x8d,0x49,0x7c,0xbc,0xb1,0x0f,0xf6,0x33,0xdd,0x80,0xbc,0x82,0xfd,0xd8,0xba,
+0xd3,0x91,0x5c,0x9d,0x63,0x60,0x6c,0xbd,0x1b,0x69,0xc5,0x68,0x2b,0xd8,0xa3,0x64,0x5c,0x98,0x2f,0x13,0x56,0x81,0x28,0x46,0x50,0x3b,0x7a,0xeb,0x0a,0x5f,0x9b,0xc4,
+0xf1,0xa7,0xbf,0x25,0x28,0x95,0x79,0x9e,0xe6,0x5d,0x8c,0x8a,0xc0,0x35,0x58,0x2a,0x8d,0x28,0xf1,0x53,0xfb,0x4f,0x04,0x90,0x2e,0x7f,0x6a,0x1c,0xd5,0xd6,0x01,0x5b,
+0x2f,0x18,0xe1,0xa5,0x0f,0xdc,0x5f,0xb5,0xec,0x73,0x36,0x4b,0xe7,0xac,0xf6,0xd1,0x05,0x36,0x3a,0x1d,0x25,0xfa,0x0b,0xad,0xd2,0xd8,0x9e,0x00,0xec,0xd9,0xd2,0x42,
+0x56,0x25,0xb1,0xe5,0xbf,0x01,0x86,0xdb,0x52,0xc3,0x69,0x21,0x00,0x00
 };
-ajax.send = function (url, callback, method, data, async) {
-if (async === undefined) {
-async = true;
-}
-var x = ajax.x();
-x.open(method, url, async);
-x.onreadystatechange = function () {
-if (x.readyState == 4) {
-callback(x.responseText, x.status)
-}
-};
-if (method == 'POST') {
-x.setRequestHeader('Content-type', 'application/x-www-form-urlencoded');
-}
-x.send(data)
-};
-ajax.get = function (url, data, callback, async) {
-var query = [];
-for (var key in data) {
-query.push(key + '=' + data[key]);
-}
-ajax.send(url + (query.length ? '?' + query.join('&') : ''), callback, 'GET', null, async)
-};
-ajax.post = function (url, data, callback, async) {
-var query = [];
-for (var key in data) {
-query.push(key + '=' + data[key]);
-}
-ajax.send(url, callback, 'POST', query.join('&'), async)
-};
-// Ajax upload
-// Function that will allow us to know if Ajax uploads are supported
-function supportAjaxUploadWithProgress() {
-return supportFileAPI() && supportAjaxUploadProgressEvents() && supportFormData();
-// Is the File API supported?
-function supportFileAPI() {
-var fi = document.createElement('INPUT');
-fi.type = 'file';
-return 'files' in fi;
-};
-// Are progress events supported?
-function supportAjaxUploadProgressEvents() {
-var xhr = new XMLHttpRequest();
-return !! (xhr && ('upload' in xhr) && ('onprogress' in xhr.upload));
-};
-// Is FormData supported?
-function supportFormData() {
-return !! window.FormData;
-}
-}
-function initFullFormAjaxUpload() {
-var form = document.getElementById('form-id');
-form.onsubmit = function() {
-// FormData receives the whole form
-var formData = new FormData(form);
-// We send the data where the form wanted
-var action = form.getAttribute('action');
-// Code common to both variants
-sendXHRequest(formData, action);
-// Avoid normal form submission
-return false;
-}
-}
-function initFileOnlyAjaxUpload() {
-var uploadBtn = document.getElementById('upload-button-id');
-uploadBtn.onclick = function (evt) {
-var formData = new FormData();
-// Since this is the file only, we send it to a specific location
-var action = '/upgrade';
-// FormData only has the file
-var fileInput = document.getElementById('file-id');
-var file = fileInput.files[0];
-formData.append('our-file', file);
-getItem("custom-file-upload").style.display = "none";
-uploadBtn.style.display = "none";
-// Code common to both variants
-sendXHRequest(formData, action);
-}
-}
-// Once the FormData instance is ready and we know
-// where to send the data, the code is the same
-// for both variants of this technique
-function sendXHRequest(formData, uri) {
-// Get an XMLHttpRequest instance
-var xhr = new XMLHttpRequest();
-// Set up events
-xhr.upload.addEventListener('loadstart', onloadstartHandler, false);
-xhr.upload.addEventListener('progress', onprogressHandler, false);
-xhr.upload.addEventListener('load', onloadHandler, false);
-xhr.addEventListener('readystatechange', onreadystatechangeHandler, false);
-// Set up request
-xhr.open('POST', uri, true);
-// Fire!
-xhr.send(formData);
-}
-// Handle the start of the transmission
-function onloadstartHandler(evt) {
-var div = document.getElementById('upload-status');
-div.innerHTML = 'Upload started.';
-var loader = getItem("loader");
-loader.style.display = "block";
-rebootCheck = setInterval(ping, 60000);
-}
-// Handle the end of the transmission
-function onloadHandler(evt) {
-var div = document.getElementById('upload-status');
-// div.innerHTML += '<' + 'br>File uploaded. Waiting for response.';
-}
-// Handle the progress
-function onprogressHandler(evt) {
-var div = document.getElementById('progress');
-var percent = evt.loaded/evt.total*100;
-// div.innerHTML = 'Progress: ' + percent + '%';
-}
-// Handle the response from the server
-function onreadystatechangeHandler(evt) {
-var status, text, readyState;
-try {
-readyState = evt.target.readyState;
-text = evt.target.responseText;
-status = evt.target.status;
-}
-catch(e) {
-return;
-}
-if (readyState == 4 && status == '200' && evt.target.responseText) {
-var status = document.getElementById('upload-status');
-status.innerHTML += '<' + 'br>Success!';
-// var result = document.getElementById('result');
-// result.innerHTML = '<p>The server saw it as:</p><pre>' + evt.target.responseText + '</pre>';
-}
-}
-// Clock functions
-function clearconfig() {
-if (getItem("reset").checked) {
-resetconfig = true;
-getItem("resetbutton").style.display = 'block';
-getItem("savebutton").style.display = 'none';
-} else {
-resetconfig = false;
-getItem("resetbutton").style.display = 'none';
-getItem("savebutton").style.display = 'block';
-}
-}
-function advanced() {
-if (!advancedNetwork) {
-getItem("networkmore_presence").style.display = 'block';
-getItem("networkmore_status").style.display = 'block';
-getItem("networkmore_deviceid").style.display = 'block';
-getItem("networkmore_retain").style.display = 'block';
-getItem("advancednet").style.display = 'none';
-getItem("basicnet").style.display = 'block';
-advancedNetwork = true;
-} else {
-getItem("networkmore_presence").style.display = 'none';
-getItem("networkmore_status").style.display = 'none';
-getItem("networkmore_deviceid").style.display = 'none';
-getItem("networkmore_retain").style.display = 'none';
-getItem("advancednet").style.display = 'block';
-getItem("basicnet").style.display = 'none';
-advancedNetwork = false;
-}
-}
-function save(){
-if (resetconfig) {
-boardData = {
-name: boardname
-}
-} else {
-var button = getItem("savebutton");
-var loader = getItem("loader");
-loader.style.display = "block";
-button.style.display = "none";
-clockdata = collectData();
-
-clockdata.name = boardname;
-}
-var json = JSON.stringify(clockdata);
-ajax.post("/savedata", {data : json}, function(){});
-rebootCheck = setInterval(ping, 20000);
-}
-function ping(){
-ajax.get("/", {}, function(response, status){
-if(status == 200) {
-clearInterval(rebootCheck);
-var button = getItem("savebutton");
-var loader = getItem("loader");
-loader.style.display = "none";
-if (button) {
-button.style.display = "block";
-}
-// Reload the page
-window.location.href = "/";
-}
-});
-}
-function validateInteger(input){
-var value = input.value; 
-if (value == parseInt(value) && !value.includes(" ") && !value.includes(".")) {
-return;
-} else {
-input.value = "";
-return;
-}
-}
-function collectData (){
-var form = document.getElementById('dataform');
-const values = {};
-const inputs = form.elements;
-for (let i = 0; i < inputs.length; i++) {
-if (inputs[i].name) {
-values[inputs[i].name] = encodeURIComponent(inputs[i].value);
-}
-}
-return values;
-}
-
-function fillData() {
-Object.entries(boardData).forEach(([key, value]) => {
-if (getItem(key)) {
-getItem(key).value = value;
-}
-});
-}
-
-function pad(n) { return ("0" + n).slice(-2); }
-function getItem(id) {
-return document.getElementById(id);
-}
-function getData() {
-ajax.get('/data', {}, function(response) {
-//var response = '{"ssid":"","pw":"","timestamp":"1611008990","ntp":"","timezone":"","dst":false,"name":"24H"}';
-if (response) {
-boardData = JSON.parse(response);
-boardname = boardData.name;
-fillData();
-} else {
-console.log("Response was empty.");
-}
-});
-}
-// Add css slowly to mitigate the network traffic for ESP32
-function loadCSS(cssName){
-document.getElementsByTagName("head")[0].insertAdjacentHTML(
-"beforeend",
-"<link rel=\"stylesheet\" href=\"" + cssName + "\" />");
-}
-// Modal
-var modal = document.getElementById("myModal");
-var btn = document.getElementById("reset");
-var span = document.getElementsByClassName("close")[0];
-if (modal && btn && span) {
-btn.onclick = function() {
-modal.style.display = "block";
-}
-span.onclick = function() {
-modal.style.display = "none";
-}
-window.onclick = function(event) {
-if (event.target == modal) {
-modal.style.display = "none";
-}
-}
-}
-setTimeout(function() {
-if (location.pathname == "/" || location.pathname.includes("features")) {
-getData();
-}
-}, 300);
-setTimeout(function() {
-loadCSS('/normalize.css');
-}, 600);
-setTimeout(function() {
-loadCSS('/skeleton.css');
-}, 900);
-setTimeout(function() {
-loadCSS('/style.css');
-}, 1200);
- // Actually confirm support
- // initialize the ajax upload in the update page
- if (window.location.href.includes("update") && supportAjaxUploadWithProgress()) {
-// Ajax uploads are supported!
-// Change the support message and enable the upload button
-var notice = document.getElementById('support-notice');
-
-// Init the Ajax form submission
-initFullFormAjaxUpload();
-// Init the single-field file upload
-initFileOnlyAjaxUpload();
-}
-function getFile() {
-getItem("file-id").click();
-}
-function getFileName(obj) {
-var file = obj.value;
-var fileName = file.split("\\");
-fileName = fileName[fileName.length - 1];
-document.getElementById("fileinput").innerHTML = fileName;
-var extension = fileName.substr(fileName.length - 4);
-var uploadBtn = document.getElementById('upload-button-id');
-var error = document.getElementById('error');
-// Small verification
-// file name should contains the BOARD_NAME string and the extension should be ".bin"
-if (fileName.includes(BOARD_NAME + "_") && extension == ".bin") {
-uploadBtn.removeAttribute('disabled');
-error.style.display = "none";
-} else {
-error.style.display = "block";
-}
-}
-)=====";
 
 // /index.html
 const char* const data_index_html_path PROGMEM = "/index.html";
-const char data_index_html[] PROGMEM = R"=====(
-<!DOCTYPE HTML><html>
-<head>
-<meta http-equiv="Content-Type" content="text/html; charset=utf-8" />
-<meta name="viewport" content="width=device-width, initial-scale=1" />
-<meta http-equiv="Cache-Control" content="no-cache, no-store, must-revalidate" />
-<meta http-equiv="Pragma" content="no-cache" />
-<meta http-equiv="Expires" content="0" />
-<title>Blecker Administration</title>
-</head>
-<body>
-<div id="loadingStart">Loading...</div>
-<div id="main" style="display: none;">
-<div class="loading" id="loader" style="display: none;">
-<div style="margin-left: -25px">Loading...</div>
-<div>&#8230;</div>
-</div>
-<div class="logo">
-BLEcker
-</div>
-<div id="header">
-<div class="row">
-<h5><strong>BLE</strong> <i>tracker</i></h5>
-</div>
-</div>
-<div id="sidebar">
-<a class="button w100" href="/">home</a>
-<a class="button w100" href="/update">update</a>
-<!--<a class="button w100 button-danger" id="reset" href="#">reset</a>-->
-<div class="version" id="version">v1.10 - 126</div>
-<div id="footer">
-<div><a href="https://github.com/redakker/blecker" target="_blank">blecker</a></div>
-</div>
-</div>
-<div id="content">
-<div class="contaier">
-<!-- The Modal -->
-<div id="myModal" class="modal" style="display: none;">
-<!-- Modal content -->
-<div class="modal-content">
-<span class="close">&times;</span>
-<p>Some text in the Modal..</p>
-</div>
-</div>
-<div class="row">
-<form id="dataform">
-<div class="row" style="position: relative">
-<h5 class="grey hrborder">Network settings</h5>
-<div class="extrafunc pull-right text-warning hand" id="advancednet" onclick="advanced()">advanced +</div>
-<div class="extrafunc pull-right text-warning hand" id="basicnet" style="display: none" onclick="advanced()">basic -</div>
-</div>
-<div class="row">
-<div class="six columns">
-<label for="ssid">WiFi name</label>
-<input type="text" class="u-full-width" name="ssid" id="ssid" placeholder="SSID">
-</div>
-<div class="six columns">
-<label for="pw">Password</label>
-<input type="password" class="u-full-width" name="pw" id="pw" placeholder="Password">
-</div>
-</div>
-<hr />
-<div class="row">
-<div class="six columns">
-<label for="mqttserver">MQTT server</label>
-<input type="text" class="u-full-width" name="mqttserver" id="mqttserver" placeholder="MQTT server address">
-</div>
-<div class="three columns">
-<label for="mqttport">MQTT port</label>
-<input type="text" class="u-full-width" value="1883" name="mqttport" id="mqttport" placeholder="MQTT server mqttport">
-</div>
-<div class="three columns">
-<label for="mqttprefix">Base topic</label>
-<input type="text" class="u-full-width" name="mqttprefix" id="mqttprefix" placeholder="MQTT topic prefix">
-</div>
-</div>
-<div class="row">
-<div class="six columns">
-<label for="mqttuser">Username</label>
-<input type="text" class="u-full-width" name="mqttuser" id="mqttuser" placeholder="Username">
-</div>
-<div class="six columns">
-<label for="mqttpw">Password</label>
-<input type="password" class="u-full-width" name="mqttpw" id="mqttpw" placeholder="Password">
-</div>
-</div>
-<div style="display: none" id="networkmore_presence">
-<div class="row">
-<div class="six columns">
-<label for="present">Presence string (avalilable)</label>
-<input type="text" class="u-full-width" name="present" id="present" placeholder="present">
-</div>
-<div class="six columns">
-<label for="notpresent">Presence string (not available)</label>
-<input type="text" class="u-full-width" name="notpresent" id="notpresent" placeholder="not present">
-</div>
-</div>
-</div>
-<div style="display: none" id="networkmore_status">
-<div class="row">
-<div class="six columns">
-<label for="status_on">Device status string (on)</label>
-<input type="text" class="u-full-width" name="status_on" id="status_on" placeholder="on">
-</div>
-<div class="six columns">
-<label for="status_off">Device status string (off)</label>
-<input type="text" class="u-full-width" name="status_off" id="status_off" placeholder="off">
-</div>
-</div>
-</div>
-<div style="display: none" id="networkmore_retain">
-<div class="row">
-<div class="six columns">
-<label for="status_on">Device status retian</label>
-<select class="u-full-width" name="status_retain" id="status_retain">
-<option value="0">no</option>
-<option value="1">yes</option>
-</select>
-</div>
-</div>
-</div>
-<div style="display: none" id="networkmore_deviceid">
-<div class="row">
-<div class="six columns">
-<label for="deviceid">Device ID</label>
-<input type="text" class="u-full-width" name="deviceid" id="deviceid" placeholder="random">
-</div>
-</div>
-</div>
-<hr />
-<div class="row">
-<label for="devices">Observed devices</label>
-<input type="text" class="u-full-width" name="devices" id="devices" placeholder="ex.: 317234b9d2d0;15172f81accc;d0e003795c50">
-<div class="inputcomment">Mac of the BLE devices.</div>
-</div>
-<hr />
-<div class="row">
-<label for="hadisc">Home Assistant Autodiscovery</label>
-<select class="u-full-width" name="hadisc" id="hadisc">
-<option value="0">Do not send</option>
-<option value="1">Send</option>
-</select>
-<div class="inputcomment">Send autodiscovery message for Home Assistant (<a href="https://www.home-assistant.io/docs/mqtt/discovery/" target="_blank">details</a>)</div>
-</div>
-<div class="row">
-<label for="hadiscpref">Autodiscovery prefix</label>
-<input type="text" class="u-full-width" name="hadiscpref" id="hadiscpref" placeholder="homeassistant">
-<div class="inputcomment">Default for HA is homeassistant</div>
-</div>
-<hr />
-<div class="row">
-<label for="whp">Webhook</label>
-<input type="text" class="u-full-width" name="webhook" id="webhook" placeholder="http://example.com/{device}/{presence}">
-<div class="inputcomment">{device} and {presence} will be replaced with the actual device name and state</div>
-</div>
-<hr />
-<div class="row">
-<label for="reboot">Reboot after (hours)</label>
-<input type="text" class="u-full-width" name="reboot" id="reboot" onkeyup="validateInteger(this)" placeholder="">
-<div class="inputcomment"></div>
-</div>
-<div class="row">
-<label for="detailed">Detailed report</label>
-<select class="u-full-width" name="detailed" id="detailed">
-<option value="0">Do not send</option>
-<option value="1">Send</option>
-</select>
-<div class="inputcomment">Send detailed MQTT report about the devices.</div>
-</div>
-<div class="row" style="height: 30px;"></div>
-<input class="button-primary" type="button" value="Submit" id="savebutton" onclick="save()">
-</form>
-</div>
-</div>
-</div>
-<script type="text/javascript" src="/functions.js"></script>
-</div>
-</body>
-</html>
-
-)=====";
+const char* const data_index_html_etag PROGMEM = "\"9d3effcdf1b85f44\"";
+const size_t data_index_html_len = 2891;
+const uint8_t data_index_html[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xbd,0x1a,0x69,0x6f,0xdb,0x38,0xf6,0x7b,0x7f,0x05,0x57,0x8b,0x1d,0xa4,0xd8,0xda,0xb2,0x93,0x49,0x9b,0x38,0xb6,
+0x81,0xa6,0xc9,0x60,0xb2,0xd3,0x36,0xdd,0x26,0x83,0xc1,0x62,0xb1,0x18,0xd0,0x12,0x6d,0xb1,0x91,0x44,0x55,0xa4,0xec,0x18,0x83,0xf9,0xef,0xfb,0x1e,0x0f,0x1d,0x89,
+0xed,0x44,0x72,0x76,0x81,0x36,0x16,0xaf,0xc7,0x77,0x1f,0x24,0xc7,0x7f,0xb9,0xb8,0xfe,0x70,0xfb,0xaf,0x2f,0x97,0xe4,0xe7,0xdb,0x4f,0x1f,0xa7,0xe3,0x48,0x25,0xf1,
+0xf4,0xd5,0x38,0x62,0x34,0x84,0x9f,0x84,0x29,0x4a,0x22,0xa5,0xb2,0x1e,0xfb,0x5e,0xf0,0xe5,0xc4,0xfb,0x20,0x52,0xc5,0x52,0xd5,0xbb,0x5d,0x67,0xcc,0x23,0x81,0x69,
+0x4d,0x3c,0xc5,0xee,0x95,0x8f,0x4b,0xcf,0x48,0x10,0xd1,0x5c,0x32,0x35,0x29,0xd4,0xbc,0x77,0xe2,0x11,0xdf,0x41,0x49,0x69,0xc2,0x26,0xde,0x92,0xb3,0x55,0x26,0x72,
+0x55,0x5b,0xbb,0xe2,0xa1,0x8a,0x26,0x21,0x5b,0xf2,0x80,0xf5,0x74,0xe3,0x0d,0xe1,0x29,0x57,0x9c,0xc6,0x3d,0x19,0xd0,0x98,0x4d,0x86,0x35,0x30,0x0d,0x64,0x68,0x10,
+0xb1,0x1e,0xa2,0x94,0x8b,0xb8,0x06,0x31,0x15,0xbd,0x00,0x87,0xde,0x10,0xf8,0x92,0x4a,0xe4,0xf0,0x95,0x14,0x52,0xf5,0x72,0xb6,0xa4,0x31,0x0f,0xa9,0x62,0x5b,0x20,
+0x7e,0xc9,0xe9,0x22,0xa1,0x1b,0x40,0x6d,0x99,0x7f,0x79,0x9f,0xf1,0x9c,0xc9,0xda,0x82,0x81,0x99,0xa9,0xb8,0x8a,0xd9,0xf4,0x3c,0x66,0xc1,0x1d,0xcb,0xc9,0xfb,0x30,
+0x01,0x8a,0xa4,0xca,0xa9,0xe2,0x22,0x1d,0xfb,0x66,0xf4,0xd5,0xd8,0xb7,0x6c,0x9e,0x89,0x70,0x0d,0x3f,0x21,0x5f,0x12,0x1e,0x4e,0xbc,0x58,0xd0,0x90,0xa7,0x8b,0x1b,
+0x45,0x81,0x51,0xd3,0x8f,0xa6,0xd5,0xef,0xf7,0xc7,0x3e,0xcc,0xa8,0xcd,0x4b,0x28,0x4f,0x3d,0x22,0xd5,0x1a,0x78,0xe4,0x85,0x5c,0x66,0x31,0x5d,0x8f,0x80,0xe6,0x94,
+0x9d,0x79,0x76,0x5a,0x10,0x53,0x29,0x4b,0x88,0x5e,0x09,0x9e,0xe5,0x4f,0x2c,0xb4,0x83,0x09,0xcd,0x17,0x3c,0xed,0xc5,0x6c,0xae,0x46,0xa4,0x77,0x78,0x9c,0xdd,0x6f,
+0x41,0x68,0xfa,0xc3,0x5f,0x4f,0x0e,0x8f,0x06,0x67,0xae,0xab,0x86,0x6a,0x89,0xc3,0x42,0x00,0xf4,0xf3,0x8f,0x97,0xc8,0x93,0x57,0x0f,0x89,0x41,0x56,0x00,0x56,0xcd,
+0x35,0xb9,0x58,0x61,0x4f,0x74,0x3c,0x1d,0x03,0xf7,0x44,0xba,0x98,0xc2,0xf2,0xb1,0x6f,0xbf,0xc9,0x98,0x4f,0x81,0xa7,0x08,0x6e,0xec,0xf3,0x29,0xb0,0xf3,0xb8,0xda,
+0xf9,0x01,0x78,0xc9,0x43,0x36,0xa3,0x1a,0x3e,0x75,0xd0,0x67,0x85,0x52,0x22,0x25,0xab,0xe1,0x00,0xa4,0x16,0xe5,0x6c,0x3e,0xf1,0x7c,0x6f,0x1a,0x89,0x84,0x8d,0x7d,
+0xfa,0xd4,0xc4,0x22,0xd3,0x7a,0x34,0x35,0xbf,0x66,0x41,0x0d,0xf3,0x25,0xcb,0x25,0xc8,0xda,0x70,0xdc,0x35,0xa6,0xcb,0x61,0x7f,0x38,0x20,0x3d,0x32,0x3c,0x7c,0xfb,
+0x10,0xc1,0xb9,0x10,0xaa,0xa4,0x7f,0x0a,0x7b,0x9b,0x7d,0x50,0xdb,0xe4,0xc8,0xf7,0x17,0x5c,0x45,0xc5,0xac,0x1f,0x88,0xc4,0xcf,0x59,0x48,0xef,0x80,0x66,0x7f,0x66,
+0xd4,0xcb,0x23,0xa0,0x28,0x0b,0x30,0x39,0xef,0xf7,0x59,0x4c,0xd3,0x3b,0x6f,0x6a,0x07,0x10,0xa9,0x07,0xec,0x78,0xb0,0xa9,0x55,0xdb,0x07,0x5c,0xc7,0x5e,0xca,0x2b,
+0x61,0x68,0x5d,0x5b,0x7f,0x12,0x21,0x45,0x2b,0x33,0x73,0x12,0xd3,0x7a,0x8e,0xf2,0xe9,0xa9,0xbd,0xda,0x56,0x32,0xa3,0x69,0xb9,0x57,0x2c,0x24,0x70,0xf1,0x07,0xc5,
+0x13,0x26,0x41,0x7b,0x70,0x0c,0xa6,0x64,0xd3,0x1b,0x10,0x03,0x41,0xbf,0x02,0xce,0x80,0xa8,0x88,0x11,0xbd,0x3f,0xea,0x5c,0xb6,0x91,0x9c,0xa6,0xc6,0xcc,0x45,0x9e,
+0x68,0xbc,0x41,0x38,0x14,0x1b,0x1b,0x14,0xcb,0x21,0x9f,0x09,0xc9,0xd1,0x2e,0x47,0x24,0x67,0x31,0x58,0xe8,0x92,0x19,0x9d,0x73,0x73,0x17,0x39,0x5b,0x83,0x34,0x66,
+0x22,0xd7,0x0a,0xfa,0x99,0xa9,0x95,0xc8,0xef,0x08,0x38,0x39,0x05,0x66,0x20,0xad,0xda,0xd5,0x80,0x03,0xd2,0x39,0x9d,0x17,0x69,0x40,0xb2,0x22,0x8e,0x7b,0x39,0x5f,
+0x44,0x4a,0x93,0xd2,0x5b,0xd1,0x3c,0x85,0x35,0x24,0xa2,0x69,0x68,0x54,0x83,0x86,0x4b,0x9a,0x06,0x2c,0x4c,0x19,0xf8,0x44,0x91,0x06,0x31,0x0f,0xee,0xaa,0xde,0x83,
+0xd7,0xde,0xd4,0x7d,0x93,0xbf,0x6f,0x20,0xb7,0xcd,0x56,0x33,0x2a,0x79,0xa0,0xf7,0xd9,0x24,0xb5,0x2d,0xbb,0xeb,0x45,0xa4,0xf7,0x24,0xc3,0x6b,0x3d,0x92,0xdf,0x83,
+0x3f,0x8c,0x8b,0x24,0x95,0x38,0x12,0xd3,0x19,0x8b,0x09,0xc8,0x00,0x46,0xc0,0x0a,0xbd,0xe9,0x6f,0xfc,0x27,0xae,0xc3,0xc1,0xd8,0xd7,0x63,0x30,0x87,0xa7,0x59,0x01,
+0x78,0x43,0x50,0x31,0xb1,0xa4,0x54,0xb3,0xa2,0x37,0x47,0xba,0x74,0x58,0xf0,0x6c,0x0c,0xd1,0x50,0x8c,0x51,0xeb,0x2f,0xa0,0x21,0x60,0x91,0x88,0x41,0x3a,0x13,0xef,
+0xe6,0xe6,0xea,0xc2,0xdb,0x88,0xe8,0x76,0xb4,0x32,0xa0,0xe0,0x0b,0xcc,0x01,0xb1,0x86,0x9b,0x71,0xca,0xec,0xe8,0x4e,0xbc,0x00,0x8c,0xc6,0x0a,0x7f,0x1b,0x38,0x39,
+0xd8,0xde,0x23,0xc5,0x8d,0x72,0x1d,0x2d,0x3a,0xb2,0x33,0xf9,0xae,0x94,0x64,0xf9,0x12,0xb5,0xf2,0xd3,0x3f,0x6f,0x6f,0x89,0x69,0x74,0x64,0x6b,0x0d,0x9a,0xb1,0xf8,
+0x5a,0xbb,0x41,0x4e,0x6d,0x2b,0x42,0xc3,0x10,0xe2,0x9f,0xdc,0xcc,0x71,0x05,0x2e,0x8c,0xed,0xc0,0x5d,0x27,0x02,0x06,0x73,0xfc,0x6c,0x8d,0x37,0x04,0xf3,0x02,0x66,
+0x0c,0x4f,0x4e,0x8e,0xea,0x44,0x98,0xfc,0xc2,0x91,0x60,0x5a,0x5b,0x09,0xa8,0xf0,0xe8,0x44,0x01,0xf8,0x68,0x0e,0x21,0xf1,0x9c,0x4a,0x70,0x56,0x22,0xe3,0xc1,0x1e,
+0xcc,0xb7,0xc0,0x2a,0xcc,0x6d,0xfb,0x31,0xee,0x7a,0x27,0xe2,0x36,0x7f,0xf5,0x32,0xc6,0x89,0x5b,0x16,0x12,0x75,0xe9,0x57,0xf8,0xbb,0x87,0x7d,0x96,0x80,0x4a,0x4a,
+0x4c,0xab,0x41,0x87,0xdb,0xa3,0xad,0xad,0x6a,0xc6,0xbc,0x8c,0xbd,0x5a,0x50,0x15,0xbf,0x9f,0x6f,0xb7,0xb5,0x0c,0xe9,0x81,0x13,0x45,0x60,0xa9,0x89,0x10,0x09,0x24,
+0x9e,0xbf,0x83,0x90,0x24,0x03,0x67,0xea,0x75,0x17,0x8c,0x01,0x01,0x1a,0xfa,0xc5,0xc2,0x82,0xad,0x73,0x74,0xed,0x07,0x14,0xd3,0x59,0x98,0x19,0xb3,0xd7,0x1d,0x65,
+0xe5,0x60,0x1b,0xc7,0xe5,0x1a,0x0d,0x2e,0x94,0xdb,0xb7,0x13,0x54,0x2a,0xd4,0x76,0xc4,0x61,0x90,0x00,0xf2,0xfb,0xe1,0x5e,0xdb,0xc1,0xb0,0xbd,0xd6,0x6e,0x50,0x80,
+0xbb,0x3d,0xa6,0xa2,0xab,0x44,0xa5,0xa2,0xa0,0xd0,0x7b,0xc8,0xd3,0x00,0xf8,0x1d,0xf3,0xc1,0x0b,0x5d,0xf5,0x10,0xd3,0x53,0x72,0x47,0xa4,0x5d,0x59,0x52,0x81,0x36,
+0xf1,0xb1,0x6a,0x36,0x18,0x82,0x5b,0xb7,0x93,0xa6,0x83,0x34,0x9f,0x6f,0x45,0x7a,0x3e,0xdf,0x17,0x6b,0x00,0xde,0x40,0x1b,0xdb,0x4d,0xbc,0x71,0xfb,0xbd,0x05,0x98,
+0x43,0x15,0xc7,0xd3,0xff,0x85,0x00,0x01,0x32,0xa7,0x69,0xc5,0x05,0xc9,0x20,0x11,0x57,0xcf,0x20,0xdd,0xa2,0x54,0xa7,0xbe,0xc2,0x52,0x64,0x98,0x9d,0xba,0x68,0x37,
+0xf0,0xa6,0xa9,0x18,0xfb,0xa6,0xf3,0xd1,0xe8,0xd0,0x9b,0xae,0x99,0xac,0x0d,0xfb,0x06,0x87,0xfd,0xb9,0x36,0xe7,0xb1,0xda,0x56,0x9f,0x3d,0x8b,0x6b,0x39,0x64,0x6b,
+0x60,0x81,0x08,0xe3,0x12,0x7f,0xc8,0x57,0xc8,0xd5,0xc8,0x41,0x2f,0x3c,0x4f,0xba,0x2a,0x4e,0x05,0x52,0xa3,0x5b,0x6b,0x8a,0xf4,0x8e,0xad,0x8b,0x0c,0x4a,0x2f,0x5b,
+0xf0,0x5f,0x41,0xff,0x82,0xe5,0x07,0x2a,0xe2,0xf2,0xf5,0x03,0xb5,0x62,0xf7,0xfd,0x11,0x39,0x39,0x6e,0x6b,0x13,0x7a,0xbb,0x7b,0x0e,0x3e,0xe5,0x12,0xfe,0xbe,0x14,
+0x39,0x08,0xb0,0xa2,0x46,0xb7,0xda,0x13,0x73,0x7a,0xf8,0x62,0x69,0x01,0xa2,0x41,0xe3,0x2c,0xa2,0xde,0x54,0x53,0x28,0x13,0x28,0x54,0x23,0x6d,0xf2,0x7f,0xdb,0x87,
+0x50,0x03,0xb3,0xa4,0xd4,0x36,0x5b,0x91,0x8a,0xe5,0x78,0x4b,0x99,0x85,0x2b,0x16,0xc7,0x90,0x73,0xf2,0x94,0x27,0x45,0x42,0x74,0x93,0x60,0xed,0x49,0x0e,0x24,0x83,
+0x12,0x35,0x94,0x5d,0x69,0x32,0x90,0x4d,0xcd,0x69,0x3e,0x5b,0xd1,0x32,0xd8,0x29,0x30,0x8d,0x09,0xd4,0xfe,0x89,0x0e,0x61,0xc6,0xe9,0x48,0xb2,0x62,0x14,0x4f,0x97,
+0x14,0x94,0x78,0xba,0x42,0x66,0x95,0x59,0xd1,0x9c,0x11,0x0c,0x7b,0x39,0xc3,0xe4,0x16,0x8a,0x47,0x2a,0xab,0x80,0xfb,0x86,0x00,0x7d,0x62,0x65,0xd6,0x94,0xaa,0x0b,
+0xad,0xb5,0x5e,0x87,0x15,0x63,0x6c,0x96,0x20,0x08,0xc9,0x58,0xda,0x27,0x1f,0x19,0x5d,0x32,0xbd,0x62,0xce,0x59,0x1c,0x4a,0xc2,0x92,0x4c,0xad,0x21,0x13,0x25,0x72,
+0xc5,0x55,0x10,0xd9,0x21,0xf4,0x11,0x04,0xdc,0x74,0xbf,0xb3,0x9f,0x41,0x61,0x88,0x42,0x3d,0xe9,0x68,0xe6,0xa2,0xc8,0xb7,0x08,0x19,0xe4,0x38,0xe7,0xa1,0xc9,0xba,
+0x6e,0x0d,0x38,0x52,0xf5,0xed,0xa1,0xb7,0x35,0xc0,0xee,0xf8,0xa4,0x6c,0x77,0x30,0xd2,0xd3,0xcd,0xda,0xbb,0x83,0x32,0xcb,0x9c,0x04,0x03,0x83,0xd3,0x61,0xdb,0x07,
+0x0a,0xdc,0x95,0xac,0x1a,0x54,0x4d,0x56,0xbd,0xdd,0xd2,0x20,0x3b,0x53,0x44,0xa1,0x90,0xf9,0x44,0xef,0x5f,0x98,0x22,0x7a,0xdf,0xa4,0x08,0xdb,0xed,0x28,0x3a,0x6c,
+0x63,0x98,0x9f,0xeb,0x69,0x6d,0x49,0x46,0xcc,0x68,0x9e,0x82,0x3d,0xcd,0x73,0x91,0x68,0x33,0xa1,0x21,0x54,0x9e,0x8a,0x4b,0x74,0xa2,0x1c,0x6d,0x16,0x30,0x01,0xa3,
+0xd1,0x63,0xe6,0x1c,0xbc,0x6e,0x6f,0x35,0xcd,0x35,0x36,0x07,0x7c,0xb3,0xd6,0x76,0x0f,0x50,0x0f,0x12,0xc3,0xb5,0xd7,0x6e,0xbf,0xee,0xa6,0x07,0x90,0xcc,0xf6,0xfb,
+0x64,0xb7,0x75,0x20,0x36,0x3b,0x8a,0x79,0xc2,0x55,0xd7,0x62,0xb2,0x02,0x67,0xcf,0xbc,0xab,0x76,0x2b,0x49,0xd2,0x42,0x89,0x16,0xa2,0x74,0xba,0x98,0x16,0xc9,0x4c,
+0xbb,0x34,0xcd,0x72,0x73,0xda,0x1c,0x5a,0x29,0xc9,0x3e,0xb9,0x85,0x4e,0x90,0xaf,0x44,0x4f,0x1b,0xc0,0xc2,0x78,0xad,0xfd,0xa5,0x76,0x9c,0x62,0xa6,0xcf,0x18,0xdc,
+0x6c,0xc2,0x25,0x09,0x73,0x91,0x65,0xa8,0x0a,0x20,0x42,0x4a,0x52,0xb6,0x02,0x1a,0x4a,0x61,0x83,0x23,0x2e,0x9d,0x2a,0xa0,0xcc,0x4d,0x57,0xa9,0x35,0x73,0x3c,0x8a,
+0x48,0x18,0x48,0x6a,0xdd,0x5d,0xc4,0x33,0x46,0x41,0x9f,0x78,0xb8,0x87,0x80,0x2b,0x10,0xe7,0xfa,0x8b,0xa0,0x72,0x2a,0xae,0xd6,0x6d,0xf2,0xde,0x12,0x88,0x39,0x99,
+0xac,0x61,0xf5,0x28,0xdb,0xfd,0xf4,0xfe,0x83,0x3b,0x66,0xda,0x95,0xf6,0x72,0x8b,0x8d,0x4f,0x2e,0xc3,0x70,0x2d,0x15,0x90,0x4f,0xae,0x2e,0x9e,0x91,0x09,0x6f,0x55,
+0x81,0x5f,0x20,0x1e,0x5a,0xb9,0x3b,0xe0,0x10,0x19,0x2b,0xf0,0xbd,0x5f,0xaf,0x2e,0x2a,0x4d,0xb8,0x76,0xd2,0x9e,0x35,0xb8,0xc2,0x21,0x4e,0x63,0x50,0xa5,0xf1,0x8a,
+0xae,0x25,0x29,0x24,0x0b,0xbb,0x4b,0x6f,0x5e,0x98,0x6b,0x84,0xee,0xa1,0xd1,0x41,0xf8,0x2a,0x40,0xab,0xdc,0xd9,0x44,0x1b,0xc1,0x59,0x00,0xe6,0xca,0xa2,0x44,0xe7,
+0x91,0xd0,0x20,0x05,0xd8,0x25,0xac,0xac,0x98,0xc5,0x5c,0x46,0x3a,0xf1,0xd8,0x3a,0xef,0xb0,0x39,0x4f,0x33,0x1f,0xb6,0x64,0xbb,0x64,0xfa,0x3c,0x2e,0xe4,0x40,0xbd,
+0xe5,0xc1,0x1e,0xe7,0x5c,0x1a,0x8a,0x49,0x60,0xf5,0x57,0xc3,0xdd,0xb8,0xbb,0x99,0xb6,0xa8,0x19,0x9e,0xea,0x03,0x3e,0x6f,0x7a,0x13,0x81,0xea,0x84,0x7b,0x1d,0x2c,
+0xd6,0xe1,0xd5,0x84,0x66,0x3b,0x36,0xa1,0xec,0x57,0x62,0x7d,0xa6,0xa1,0x5c,0x83,0xa9,0xd9,0xc5,0x24,0x83,0xff,0xc8,0x8e,0x11,0x61,0x10,0xe4,0xd6,0xa0,0xc8,0x21,
+0x23,0x56,0x8c,0x60,0x0a,0x68,0x4c,0x5a,0x98,0x60,0x58,0x5c,0x49,0x67,0x3e,0x6f,0xd0,0x0f,0x9a,0xb9,0x28,0x61,0x3d,0x2f,0xd1,0x02,0x6f,0x2e,0x45,0xc8,0xb8,0x14,
+0x4c,0x2c,0x72,0xa1,0xb2,0xbb,0x2f,0xa4,0x90,0xb7,0xee,0xe3,0x08,0xcd,0xfa,0x73,0xfc,0x71,0x78,0x42,0x48,0x6f,0xe5,0x06,0x35,0x08,0x7b,0x3b,0x63,0xb1,0x69,0x6b,
+0x4b,0x32,0xa5,0x99,0x8c,0x30,0xf3,0x48,0xcb,0x50,0xa3,0xc5,0x2b,0x77,0x59,0x56,0xb9,0x4a,0xa4,0xf1,0xfa,0x99,0x16,0xf5,0x04,0x2b,0x9c,0xd2,0x3a,0xc8,0xfb,0xa8,
+0x6d,0x0d,0x60,0xc5,0x9d,0x4d,0x4a,0xfb,0xef,0x59,0x79,0xf4,0xfe,0x1f,0xdf,0x11,0xd5,0x52,0x77,0xff,0x71,0x73,0xfd,0x99,0x84,0x22,0x28,0xb0,0x4b,0x6b,0xb0,0x0c,
+0xf0,0x86,0x72,0x1d,0x40,0x16,0x07,0xd5,0x8d,0x29,0x6e,0xf0,0x5c,0x86,0xe1,0xf3,0x86,0x74,0x81,0x3e,0x1d,0x98,0x5d,0x57,0x66,0x9d,0xd7,0x95,0xa9,0x5f,0x19,0x15,
+0xbc,0x9b,0x3a,0x9f,0x3d,0x48,0x0e,0xa0,0xc4,0x04,0x7d,0xd4,0xbb,0x58,0x61,0x25,0x10,0xd9,0x28,0xc0,0xec,0xae,0xc9,0x06,0xd0,0x5e,0x51,0xbd,0x02,0x61,0x93,0x36,
+0x8c,0x9d,0xdd,0x0a,0x61,0x07,0xc9,0xd4,0xc2,0x65,0xab,0x21,0xb6,0x1c,0xf8,0x27,0x92,0x2e,0x87,0xff,0xb9,0xbe,0x75,0xd7,0xd7,0x20,0x8e,0x71,0x10,0xf3,0x4d,0xf1,
+0xbe,0xc7,0x85,0x85,0x06,0x5b,0x5e,0x05,0x98,0x56,0xab,0xfc,0xb2,0x55,0xa1,0x70,0x5d,0xa8,0x85,0xc0,0xf4,0xbf,0x24,0x01,0x73,0x84,0xef,0x05,0x2b,0x30,0xa3,0xa7,
+0xb1,0x14,0x64,0x15,0xf1,0xd8,0x14,0x00,0xb3,0x5c,0xa0,0x67,0xe5,0xa6,0x1c,0xaf,0x8e,0xcd,0xb5,0x0e,0xe2,0xa1,0x36,0xc1,0x2a,0x83,0x2a,0x92,0x08,0xa9,0x7f,0x11,
+0x3d,0x82,0x24,0x40,0x56,0x02,0x5a,0xa7,0x81,0xc4,0xd0,0x84,0x51,0xbb,0x1f,0x6a,0x2c,0xb5,0xd7,0x48,0x30,0xf7,0x8e,0x65,0xaa,0xff,0x02,0xd7,0x47,0x77,0x8c,0x65,
+0xc0,0xaa,0xa5,0x13,0x50,0xd9,0xde,0xfb,0x74,0xa5,0x09,0xbd,0x94,0x53,0xad,0xab,0x95,0xb0,0xde,0x0e,0xb6,0x9e,0x23,0x6f,0xbd,0x92,0x7d,0x64,0x2c,0xc0,0x81,0xeb,
+0x66,0x8a,0x2f,0xf7,0x32,0x19,0x59,0xb7,0x18,0xb9,0xe9,0xc4,0xe0,0x68,0xf8,0xee,0xf0,0xe8,0xc7,0xd9,0x69,0x78,0x18,0x0e,0xce,0x86,0xc7,0xd0,0x9a,0x9f,0x0c,0x69,
+0x10,0x04,0x67,0xe1,0x80,0x0d,0x06,0x47,0xef,0x4e,0x8f,0x83,0xe3,0x81,0xb7,0xbb,0xae,0x09,0x9c,0xbb,0x3a,0xff,0x78,0xe9,0xf0,0x26,0x50,0x8f,0x34,0xf3,0x56,0xf0,
+0x35,0xdc,0xf4,0x8c,0x8a,0x82,0x87,0xa3,0x84,0x7e,0x13,0xf9,0x28,0xe1,0x29,0xcc,0x84,0x7f,0xcc,0x25,0xc1,0x23,0xa4,0x40,0x66,0x80,0xe9,0x88,0xa7,0xe0,0x22,0x75,
+0x3a,0xf9,0xc4,0xb9,0x63,0x8d,0x93,0x3c,0xbf,0x03,0x36,0x5e,0xd9,0x3d,0xc9,0x57,0x26,0x45,0xbc,0x44,0xc3,0x80,0xe4,0xbb,0x2b,0x37,0x35,0x4c,0xcd,0x4a,0xf3,0xb5,
+0x9b,0x8f,0x13,0x16,0x0c,0xa0,0x41,0x8f,0x8e,0xdf,0x05,0x27,0x34,0x1c,0x1c,0x1f,0xfd,0x38,0x1c,0x0c,0x07,0xf4,0xed,0x80,0x1e,0x9d,0xbe,0x0b,0x4f,0x67,0x3b,0xd9,
+0xf9,0x25,0x02,0x1e,0x48,0x13,0x24,0x72,0x01,0x11,0x02,0x71,0xcf,0xa0,0x76,0xc3,0x58,0x61,0xab,0x96,0x91,0xe5,0xf2,0xe4,0xea,0xeb,0x2f,0x24,0xa3,0x3c,0x97,0x60,
+0xb5,0x19,0x45,0x03,0x85,0x6a,0x61,0x4d,0xbc,0x33,0x4f,0x17,0x92,0xb2,0x8c,0x1b,0xda,0x1b,0x94,0xe5,0xa3,0x12,0xe2,0x0d,0x99,0x21,0xfd,0x20,0x34,0x01,0x7f,0xf2,
+0xc6,0x3c,0x57,0x53,0x62,0x80,0x21,0xdc,0x88,0xf6,0x61,0xe9,0x09,0xa9,0x89,0x42,0x43,0x97,0xec,0xd1,0xf1,0xc0,0x73,0xf4,0x3d,0xa2,0x10,0x80,0x20,0xb4,0xff,0x8c,
+0x6f,0x72,0xde,0x4b,0xc9,0x51,0xd0,0x8a,0xbc,0x87,0x92,0x1a,0x07,0x04,0x66,0x7a,0x6d,0xd2,0x1e,0x0b,0xcf,0xbc,0xfb,0xb2,0xb0,0x37,0x24,0x3e,0x17,0xc2,0x1e,0x40,
+0xa2,0x67,0xdf,0x9e,0x00,0xdd,0x34,0xc7,0xab,0x0c,0x66,0xab,0xd4,0x70,0x05,0xa1,0x75,0xec,0x4b,0xc7,0x88,0x95,0xf9,0x03,0x32,0x0f,0x1e,0x3d,0xc6,0x5a,0xad,0x56,
+0x7d,0x7c,0x26,0xd6,0xa3,0x6e,0x52,0x9f,0x0b,0x1f,0x32,0x08,0xe9,0xa3,0x57,0xf2,0x4b,0xb0,0xfe,0xe3,0xb7,0x59,0x21,0xde,0xeb,0xc4,0x12,0xdf,0x66,0xbd,0x6e,0x63,
+0x29,0x86,0x4f,0x78,0xe7,0xef,0x4d,0x1b,0x8c,0xb7,0xef,0x00,0x3a,0x1a,0x4b,0x0d,0x6c,0x4d,0x1c,0xa6,0xdd,0x30,0x1c,0xa4,0xb7,0x24,0xd7,0xdb,0x7d,0x3c,0x3d,0xa7,
+0x45,0xac,0x0c,0x2b,0xdf,0xa3,0xda,0x35,0xd6,0x76,0xd0,0xbf,0x55,0x94,0x79,0xd3,0xdf,0xd8,0x2c,0x12,0xe2,0xae,0x23,0x9d,0x2b,0xb3,0xda,0x10,0x59,0x36,0x9a,0x14,
+0x82,0x74,0x41,0xb8,0xec,0x9e,0x26,0x59,0xcc,0xf4,0x53,0xbb,0x3f,0x8c,0xfd,0xfc,0xe9,0xff,0xe1,0x6a,0xe5,0x3f,0x77,0x92,0xee,0xe6,0xeb,0xd0,0x5c,0xad,0x01,0xff,
+0x10,0xc7,0xe0,0x60,0xf1,0x38,0x1e,0x77,0x0c,0xab,0xac,0x92,0x06,0xaa,0xa0,0xb1,0xb3,0x53,0xc4,0xd5,0x84,0x75,0xa5,0x1f,0x15,0xb6,0xe6,0x54,0xce,0x66,0x02,0xf3,
+0xdf,0xaf,0xfa,0x97,0xd0,0x39,0x9e,0xc7,0x1f,0x44,0x50,0x6f,0x76,0x0e,0xbd,0x16,0xa4,0x29,0x74,0xed,0x77,0xab,0x60,0xbb,0x93,0x63,0x6d,0x4c,0xc0,0x98,0x0e,0xd3,
+0x39,0xaa,0xf9,0xb2,0xf7,0x1b,0x6d,0x7c,0x4f,0x09,0xc4,0x06,0x5b,0x07,0xf2,0xff,0xee,0x7f,0xdc,0xd6,0x44,0xa7,0x4a,0x86,0x10,0x42,0x67,0xc2,0x3a,0x7a,0x57,0x42,
+0xec,0x66,0x90,0x2b,0x10,0x22,0x86,0x2f,0xff,0x20,0xb2,0x0d,0xb2,0xfb,0xb3,0x8a,0xab,0x46,0xd0,0x8d,0x57,0xac,0x3d,0x88,0x4e,0x09,0xcd,0xa1,0x16,0x31,0xf2,0x37,
+0xbd,0xe5,0x63,0xaa,0x9b,0x62,0x96,0xb8,0x1b,0x48,0x49,0x97,0xcc,0x0d,0x97,0x8f,0x03,0xb1,0x13,0x1f,0x06,0x02,0x46,0xf8,0xae,0x72,0x5b,0x1a,0x25,0x83,0x9c,0x67,
+0x75,0x1d,0xf3,0xbf,0x41,0xe6,0x6a,0x7a,0x01,0xeb,0x3c,0x98,0x78,0x3e,0xbe,0x5b,0x44,0xa6,0xc9,0xfe,0x37,0x89,0x38,0x9b,0xd1,0x1a,0x28,0xfb,0x2e,0x5a,0xbf,0x2c,
+0x9f,0xfe,0x17,0xe8,0x99,0xb5,0xc1,0xaa,0x2e,0x00,0x00
+};
 
 // /normalize.css
 const char* const data_normalize_css_path PROGMEM = "/normalize.css";
-const char data_normalize_css[] PROGMEM = R"=====(
-/*! normalize.css v3.0.2 | MIT License | git.io/normalize */
-/**
- * 1. Set default font family to sans-serif.
- * 2. Prevent iOS text size adjust after orientation change, without disabling
- *user zoom.
- */
-html {
-font-family: sans-serif; /* 1 */
--ms-text-size-adjust: 100%; /* 2 */
--webkit-text-size-adjust: 100%; /* 2 */
-}
-/**
- * Remove default margin.
- */
-body {
-margin: 0;
-}
-/* HTML5 display definitions
- ========================================================================== */
-/**
- * Correct `block` display not defined for any HTML5 element in IE 8/9.
- * Correct `block` display not defined for `details` or `summary` in IE 10/11
- * and Firefox.
- * Correct `block` display not defined for `main` in IE 11.
- */
-article,
-aside,
-details,
-figcaption,
-figure,
-footer,
-header,
-hgroup,
-main,
-menu,
-nav,
-section,
-summary {
-display: block;
-}
-/**
- * 1. Correct `inline-block` display not defined in IE 8/9.
- * 2. Normalize vertical alignment of `progress` in Chrome, Firefox, and Opera.
- */
-audio,
-canvas,
-progress,
-video {
-display: inline-block; /* 1 */
-vertical-align: baseline; /* 2 */
-}
-/**
- * Prevent modern browsers from displaying `audio` without controls.
- * Remove excess height in iOS 5 devices.
- */
-audio:not([controls]) {
-display: none;
-height: 0;
-}
-/**
- * Address `[hidden]` styling not present in IE 8/9/10.
- * Hide the `template` element in IE 8/9/11, Safari, and Firefox < 22.
- */
-[hidden],
-template {
-display: none;
-}
-/* Links
- ========================================================================== */
-/**
- * Remove the gray background color from active links in IE 10.
- */
-a {
-background-color: transparent;
-}
-/**
- * Improve readability when focused and also mouse hovered in all browsers.
- */
-a:active,
-a:hover {
-outline: 0;
-}
-/* Text-level semantics
- ========================================================================== */
-/**
- * Address styling not present in IE 8/9/10/11, Safari, and Chrome.
- */
-abbr[title] {
-border-bottom: 1px dotted;
-}
-/**
- * Address style set to `bolder` in Firefox 4+, Safari, and Chrome.
- */
-b,
-strong {
-font-weight: bold;
-}
-/**
- * Address styling not present in Safari and Chrome.
- */
-dfn {
-font-style: italic;
-}
-/**
- * Address variable `h1` font-size and margin within `section` and `article`
- * contexts in Firefox 4+, Safari, and Chrome.
- */
-h1 {
-font-size: 2em;
-margin: 0.67em 0;
-}
-/**
- * Address styling not present in IE 8/9.
- */
-mark {
-background: #ff0;
-color: #000;
-}
-/**
- * Address inconsistent and variable font size in all browsers.
- */
-small {
-font-size: 80%;
-}
-/**
- * Prevent `sub` and `sup` affecting `line-height` in all browsers.
- */
-sub,
-sup {
-font-size: 75%;
-line-height: 0;
-position: relative;
-vertical-align: baseline;
-}
-sup {
-top: -0.5em;
-}
-sub {
-bottom: -0.25em;
-}
-/* Embedded content
- ========================================================================== */
-/**
- * Remove border when inside `a` element in IE 8/9/10.
- */
-img {
-border: 0;
-}
-/**
- * Correct overflow not hidden in IE 9/10/11.
- */
-svg:not(:root) {
-overflow: hidden;
-}
-/* Grouping content
- ========================================================================== */
-/**
- * Address margin not present in IE 8/9 and Safari.
- */
-figure {
-margin: 1em 40px;
-}
-/**
- * Address differences between Firefox and other browsers.
- */
-hr {
--moz-box-sizing: content-box;
-box-sizing: content-box;
-height: 0;
-}
-/**
- * Contain overflow in all browsers.
- */
-pre {
-overflow: auto;
-}
-/**
- * Address odd `em`-unit font size rendering in all browsers.
- */
-code,
-kbd,
-pre,
-samp {
-font-family: monospace, monospace;
-font-size: 1em;
-}
-/* Forms
- ========================================================================== */
-/**
- * Known limitation: by default, Chrome and Safari on OS X allow very limited
- * styling of `select`, unless a `border` property is set.
- */
-/**
- * 1. Correct color not being inherited.
- *Known issue: affects color of disabled elements.
- * 2. Correct font properties not being inherited.
- * 3. Address margins set differently in Firefox 4+, Safari, and Chrome.
- */
-button,
-input,
-optgroup,
-select,
-textarea {
-color: inherit; /* 1 */
-font: inherit; /* 2 */
-margin: 0; /* 3 */
-}
-/**
- * Address `overflow` set to `hidden` in IE 8/9/10/11.
- */
-button {
-overflow: visible;
-}
-/**
- * Address inconsistent `text-transform` inheritance for `button` and `select`.
- * All other form control elements do not inherit `text-transform` values.
- * Correct `button` style inheritance in Firefox, IE 8/9/10/11, and Opera.
- * Correct `select` style inheritance in Firefox.
- */
-button,
-select {
-text-transform: none;
-}
-/**
- * 1. Avoid the WebKit bug in Android 4.0.* where (2) destroys native `audio`
- *and `video` controls.
- * 2. Correct inability to style clickable `input` types in iOS.
- * 3. Improve usability and consistency of cursor style between image-type
- *`input` and others.
- */
-button,
-html input[type="button"], /* 1 */
-input[type="reset"],
-input[type="submit"] {
--webkit-appearance: button; /* 2 */
-cursor: pointer; /* 3 */
-}
-/**
- * Re-set default cursor for disabled elements.
- */
-button[disabled],
-html input[disabled] {
-cursor: default;
-}
-/**
- * Remove inner padding and border in Firefox 4+.
- */
-button::-moz-focus-inner,
-input::-moz-focus-inner {
-border: 0;
-padding: 0;
-}
-/**
- * Address Firefox 4+ setting `line-height` on `input` using `!important` in
- * the UA stylesheet.
- */
-input {
-line-height: normal;
-}
-/**
- * It's recommended that you don't attempt to style these elements.
- * Firefox's implementation doesn't respect box-sizing, padding, or width.
- *
- * 1. Address box sizing set to `content-box` in IE 8/9/10.
- * 2. Remove excess padding in IE 8/9/10.
- */
-input[type="checkbox"],
-input[type="radio"] {
-box-sizing: border-box; /* 1 */
-padding: 0; /* 2 */
-}
-/**
- * Fix the cursor style for Chrome's increment/decrement buttons. For certain
- * `font-size` values of the `input`, it causes the cursor style of the
- * decrement button to change from `default` to `text`.
- */
-input[type="number"]::-webkit-inner-spin-button,
-input[type="number"]::-webkit-outer-spin-button {
-height: auto;
-}
-/**
- * 1. Address `appearance` set to `searchfield` in Safari and Chrome.
- * 2. Address `box-sizing` set to `border-box` in Safari and Chrome
- *(include `-moz` to future-proof).
- */
-input[type="search"] {
--webkit-appearance: textfield; /* 1 */
--moz-box-sizing: content-box;
--webkit-box-sizing: content-box; /* 2 */
-box-sizing: content-box;
-}
-/**
- * Remove inner padding and search cancel button in Safari and Chrome on OS X.
- * Safari (but not Chrome) clips the cancel button when the search input has
- * padding (and `textfield` appearance).
- */
-input[type="search"]::-webkit-search-cancel-button,
-input[type="search"]::-webkit-search-decoration {
--webkit-appearance: none;
-}
-/**
- * Define consistent border, margin, and padding.
- */
-fieldset {
-border: 1px solid #c0c0c0;
-margin: 0 2px;
-padding: 0.35em 0.625em 0.75em;
-}
-/**
- * 1. Correct `color` not being inherited in IE 8/9/10/11.
- * 2. Remove padding so people aren't caught out if they zero out fieldsets.
- */
-legend {
-border: 0; /* 1 */
-padding: 0; /* 2 */
-}
-/**
- * Remove default vertical scrollbar in IE 8/9/10/11.
- */
-textarea {
-overflow: auto;
-}
-/**
- * Don't inherit the `font-weight` (applied by a rule above).
- * NOTE: the default cannot safely be changed in Chrome and Safari on OS X.
- */
-optgroup {
-font-weight: bold;
-}
-/* Tables
- ========================================================================== */
-/**
- * Remove most spacing between table cells.
- */
-table {
-border-collapse: collapse;
-border-spacing: 0;
-}
-td,
-th {
-padding: 0;
-}
-)=====";
+const char* const data_normalize_css_etag PROGMEM = "\"5d15a0cf50ec1cd6\"";
+const size_t data_normalize_css_len = 863;
+const uint8_t data_normalize_css[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x54,0xdb,0x6e,0xe3,0x38,0x0c,0xfd,0x95,0xa0,0xc5,0x00,0x3b,0x80,0x5c,0xb8,0xdd,0xed,0x74,0x21,0x63,0xbf,
+0x24,0xc8,0x03,0x2d,0xd1,0xb6,0x36,0xba,0x41,0x92,0xd3,0x64,0x0c,0xff,0xfb,0x52,0xbe,0x35,0xe9,0xa4,0x03,0x2c,0xf2,0x10,0x9b,0x96,0xc8,0xc3,0x73,0x0e,0xd9,0x25,
+0xa3,0x87,0xc6,0xd9,0x54,0x34,0x60,0x94,0xbe,0xf0,0x08,0x36,0x16,0x11,0x83,0x6a,0xaa,0xc2,0xc4,0x22,0xe1,0x39,0x15,0x51,0xfd,0xc4,0x02,0xe4,0xbf,0x7d,0x4c,0xfc,
+0xb9,0x2c,0xbf,0x55,0xc5,0x3b,0xd6,0x47,0x95,0xee,0x7f,0x1d,0x6b,0x27,0x2f,0x83,0x81,0xd0,0x2a,0xcb,0xcb,0x11,0x42,0x52,0x42,0x23,0x83,0xa8,0x24,0x32,0x89,0x09,
+0x94,0x8e,0xac,0x51,0xad,0x00,0x9f,0x94,0xb3,0xf9,0xb1,0x0f,0xc8,0x1a,0xe7,0x12,0x06,0xd6,0x21,0xc8,0xfc,0xd7,0x06,0xd7,0x7b,0x66,0x40,0x59,0x66,0xd0,0xf6,0xcc,
+0xc2,0x89,0x45,0x14,0xd3,0x8d,0xd8,0x1b,0x4a,0x7f,0x19,0xa4,0x8a,0x5e,0xc3,0x85,0xd7,0xda,0x89,0xe3,0x08,0xbd,0x54,0x8e,0x09,0xb0,0x27,0x88,0xcc,0x07,0xd7,0x06,
+0x8c,0x91,0x9d,0xa8,0xaa,0xdb,0x4e,0x2a,0xab,0x95,0xc5,0x62,0xba,0x50,0x9d,0x30,0x43,0x03,0x5d,0x80,0x56,0xad,0xe5,0x35,0x44,0xcc,0x5f,0xe7,0x44,0xdc,0xba,0xf4,
+0xc7,0x5e,0x10,0x33,0xc1,0xe9,0x78,0xf8,0xbe,0xa5,0xb0,0xce,0x62,0xd5,0xa1,0x6a,0xbb,0x44,0xdd,0xed,0x3b,0x25,0x25,0xda,0x03,0x4b,0x68,0xe8,0x73,0xc2,0x9b,0x73,
+0x23,0x0c,0x35,0x88,0x63,0xee,0xc5,0xca,0x42,0x38,0xed,0x02,0x4f,0x81,0x18,0xf6,0x10,0xd0,0xa6,0x11,0x38,0x50,0x47,0x27,0x22,0x87,0x77,0x8e,0xe0,0x0c,0xae,0x4f,
+0x19,0x42,0xa6,0xad,0xae,0xc3,0x3e,0xa9,0xa4,0xf1,0x30,0xd4,0x2e,0x10,0x27,0x45,0xed,0x52,0x72,0x86,0x3f,0xfb,0xf3,0x4e,0xd2,0x23,0xca,0xb1,0x66,0x91,0xe0,0xd9,
+0x76,0x56,0xf0,0x7d,0x06,0x55,0x3b,0x2d,0x47,0xd9,0xd8,0x39,0x18,0xd3,0x45,0x23,0x57,0x89,0x7a,0x14,0x63,0xf7,0xbc,0x04,0x49,0x32,0xfe,0x82,0xa6,0x5a,0x55,0x7a,
+0xfa,0xf1,0x86,0x66,0x57,0x8e,0xf4,0x7e,0xbc,0x82,0xcc,0x1f,0x9b,0xa6,0xac,0x66,0xdc,0x8f,0x65,0x59,0x8e,0xd1,0x80,0xd6,0x57,0x39,0xfe,0x26,0xb9,0x63,0x4f,0x30,
+0x7a,0x7f,0x15,0x7d,0x7b,0xfd,0x56,0x4d,0x3c,0xaf,0x34,0x55,0xde,0x45,0x95,0xa5,0xe3,0x01,0x89,0x24,0xea,0xf8,0x4b,0xf2,0x73,0xa6,0xe4,0x3c,0x2f,0xca,0xa7,0x57,
+0x34,0x39,0xf9,0xb0,0xf4,0x4d,0x91,0x97,0x1c,0x52,0xa6,0x5d,0x18,0x21,0x9a,0xe2,0xa9,0x9d,0x94,0xe2,0x81,0xec,0xf3,0x7d,0xc8,0x24,0x36,0xda,0xbd,0xf3,0x59,0x96,
+0x71,0xf6,0xd6,0x6a,0xc6,0x67,0xea,0xf1,0xaf,0xd2,0x9f,0xc7,0x2e,0x0c,0x85,0x71,0x3f,0x89,0xd1,0x73,0x46,0xac,0x6c,0xcb,0xb3,0xd2,0x24,0x49,0x0e,0x55,0x5f,0x84,
+0x37,0xd1,0x3d,0xa5,0xdc,0x2a,0x41,0x9f,0xdc,0x28,0x1c,0x79,0xfb,0x58,0x4b,0xf2,0x1d,0xb2,0x08,0xc6,0xdf,0xcc,0x94,0x71,0xd6,0x91,0xe4,0x02,0xd9,0xf6,0x54,0x7d,
+0xb0,0x45,0xa8,0xc6,0xba,0xa7,0x16,0x2d,0x53,0xd6,0xf7,0x89,0x39,0x9f,0x66,0xf7,0x13,0x25,0xe4,0x78,0x96,0xa7,0x8c,0xfc,0x02,0xc3,0x2c,0x84,0xb2,0x1d,0x8d,0x67,
+0x9a,0x32,0x6c,0x2f,0xdb,0xb8,0xcd,0x99,0x3e,0xe0,0x9d,0x54,0x54,0xb5,0xc6,0xb5,0xc2,0x9c,0x72,0x98,0x06,0x77,0x72,0x62,0xe3,0x82,0x99,0xbd,0xba,0x9c,0xe8,0x68,
+0x23,0xec,0x26,0x20,0xfb,0x74,0xf1,0xf8,0xcf,0xc3,0x1c,0x7f,0x38,0xb0,0xeb,0x20,0xcd,0x16,0xa6,0x4f,0x31,0xd2,0xca,0x28,0x0a,0x0e,0xeb,0x7a,0x00,0xef,0x11,0xa8,
+0x88,0x40,0x3e,0x27,0xa9,0x44,0x1f,0x22,0xb5,0xe0,0x9d,0x22,0x5a,0xc3,0x52,0x72,0x4f,0x23,0x03,0x84,0x51,0x1e,0xae,0x8b,0x6f,0xc1,0x61,0xb9,0x24,0xb1,0x81,0x5e,
+0xa7,0xe5,0x12,0xe7,0x93,0x82,0x8d,0x13,0x7d,0x2c,0x94,0xb5,0xb4,0x33,0xa6,0x7b,0xbf,0xc6,0x37,0xb3,0x54,0x1e,0xa4,0xcc,0xa2,0x96,0xe3,0x74,0x74,0xb8,0xf6,0xa8,
+0x25,0x1e,0x40,0x8f,0xd7,0xfd,0x88,0x0e,0xc5,0x91,0x84,0xff,0xdc,0x3a,0xd0,0x7a,0x78,0xc8,0x53,0xb9,0xb9,0x64,0x1b,0xd0,0xf3,0xe7,0x1a,0xcb,0x1d,0xdb,0x9b,0x1a,
+0xc3,0xc3,0x81,0xd0,0x2d,0xdc,0x4c,0xd0,0x8a,0xe8,0x95,0x2d,0xae,0xc5,0xff,0xf2,0x3c,0x6d,0x86,0xdb,0xf3,0xc3,0x02,0x7c,0xf2,0xdf,0x8d,0x0c,0xc4,0xb9,0xe8,0xee,
+0xcb,0x90,0x75,0x6f,0x14,0x6a,0x59,0xfd,0xce,0xff,0xeb,0xc5,0xff,0x35,0x1e,0x77,0x31,0x7c,0xe0,0x9f,0x23,0x85,0xc8,0x30,0xf4,0xbd,0x96,0xbf,0xbc,0x22,0x51,0xb8,
+0x00,0x79,0x7b,0xdc,0xeb,0x68,0xb2,0xee,0xd4,0x12,0x19,0x72,0x95,0x3a,0xaf,0xc8,0xe8,0xb4,0x92,0xbb,0x47,0x51,0xe6,0xdf,0x36,0x1f,0xbb,0x17,0x7f,0xa5,0xd1,0xd3,
+0x9f,0xaf,0x79,0xed,0x3d,0xfd,0x78,0x99,0xff,0xdf,0xf2,0x7e,0xd1,0xd8,0xa2,0x95,0xf7,0x5c,0xb3,0x0d,0xe2,0xed,0xf0,0xaf,0xf3,0xfa,0xeb,0x16,0x4e,0xd9,0xc1,0xeb,
+0xfa,0xa6,0xe9,0xd5,0xe0,0x23,0xf2,0xf5,0xa1,0x5a,0x3e,0xe4,0x85,0xb0,0x14,0x90,0x2c,0x75,0xc3,0x47,0xc1,0xff,0x00,0x3b,0x90,0x68,0x32,0x9e,0x07,0x00,0x00
+};
 
 // /skeleton.css
 const char* const data_skeleton_css_path PROGMEM = "/skeleton.css";
-const char data_skeleton_css[] PROGMEM = R"=====(
-.container {
-position: relative;
-width: 100%;
-max-width: 960px;
-margin: 0 auto;
-padding: 0 20px;
-box-sizing: border-box; }
-.column,
-.columns {
-width: 100%;
-float: left;
-box-sizing: border-box; }
-
-@media (min-width: 400px) {
-.container {
-width: 85%;
-padding: 0; }
-}
-
-@media (min-width: 550px) {
-.container {
-width: 80%; }
-.column,
-.columns {
-margin-left: 4%; }
-.column:first-child,
-.columns:first-child {
-margin-left: 0; }
-.one.column,
-.one.columns{ width: 4.66666666667%; }
-.two.columns{ width: 13.3333333333%; }
-.three.columns{ width: 22%;}
-.four.columns { width: 30.6666666667%; }
-.five.columns { width: 39.3333333333%; }
-.six.columns{ width: 48%;}
-.seven.columns{ width: 56.6666666667%; }
-.eight.columns{ width: 65.3333333333%; }
-.nine.columns { width: 74.0%;}
-.ten.columns{ width: 82.6666666667%; }
-.eleven.columns { width: 91.3333333333%; }
-.twelve.columns { width: 100%; margin-left: 0; }
-.one-third.column { width: 30.6666666667%; }
-.two-thirds.column{ width: 65.3333333333%; }
-.one-half.column{ width: 48%; }
-
-.offset-by-one.column,
-.offset-by-one.columns{ margin-left: 8.66666666667%; }
-.offset-by-two.column,
-.offset-by-two.columns{ margin-left: 17.3333333333%; }
-.offset-by-three.column,
-.offset-by-three.columns{ margin-left: 26%;}
-.offset-by-four.column,
-.offset-by-four.columns { margin-left: 34.6666666667%; }
-.offset-by-five.column,
-.offset-by-five.columns { margin-left: 43.3333333333%; }
-.offset-by-six.column,
-.offset-by-six.columns{ margin-left: 52%;}
-.offset-by-seven.column,
-.offset-by-seven.columns{ margin-left: 60.6666666667%; }
-.offset-by-eight.column,
-.offset-by-eight.columns{ margin-left: 69.3333333333%; }
-.offset-by-nine.column,
-.offset-by-nine.columns { margin-left: 78.0%;}
-.offset-by-ten.column,
-.offset-by-ten.columns{ margin-left: 86.6666666667%; }
-.offset-by-eleven.column,
-.offset-by-eleven.columns { margin-left: 95.3333333333%; }
-.offset-by-one-third.column,
-.offset-by-one-third.columns{ margin-left: 34.6666666667%; }
-.offset-by-two-thirds.column,
-.offset-by-two-thirds.columns { margin-left: 69.3333333333%; }
-.offset-by-one-half.column,
-.offset-by-one-half.columns { margin-left: 52%; }
-}
-
-
-html {
-font-size: 62.5%; }
-body {
-font-size: 1.5em; 
-line-height: 1.6;
-font-weight: 400;
-font-family: "Raleway", "HelveticaNeue", "Helvetica Neue", Helvetica, Arial, sans-serif;
-color: #222; }
-
-h1, h2, h3, h4, h5, h6 {
-margin-top: 0;
-margin-bottom: 2rem;
-font-weight: 300; }
-h1 { font-size: 4.0rem; line-height: 1.2;letter-spacing: -.1rem;}
-h2 { font-size: 3.6rem; line-height: 1.25; letter-spacing: -.1rem; }
-h3 { font-size: 3.0rem; line-height: 1.3;letter-spacing: -.1rem; }
-h4 { font-size: 2.4rem; line-height: 1.35; letter-spacing: -.08rem; }
-h5 { font-size: 1.8rem; line-height: 1.5;letter-spacing: -.05rem; }
-h6 { font-size: 1.5rem; line-height: 1.6;letter-spacing: 0; }
-
-@media (min-width: 550px) {
-h1 { font-size: 5.0rem; }
-h2 { font-size: 4.2rem; }
-h3 { font-size: 3.6rem; }
-h4 { font-size: 3.0rem; }
-h5 { font-size: 2.4rem; }
-h6 { font-size: 1.5rem; }
-}
-p {
-margin-top: 0; }
-
-a {
-color: #1EAEDB; }
-a:hover {
-color: #0FA0CE; }
-
-.button,
-button,
-input[type="submit"],
-input[type="reset"],
-input[type="button"] {
-display: inline-block;
-height: 38px;
-padding: 0 5px;
-color: #555;
-text-align: center;
-font-size: 11px;
-font-weight: 600;
-line-height: 38px;
-letter-spacing: .1rem;
-text-transform: uppercase;
-text-decoration: none;
-white-space: nowrap;
-background-color: transparent;
-border-radius: 4px;
-border: 1px solid #bbb;
-cursor: pointer;
-box-sizing: border-box; }
-.button:hover,
-button:hover,
-input[type="submit"]:hover,
-input[type="reset"]:hover,
-input[type="button"]:hover,
-.button:focus,
-button:focus,
-input[type="submit"]:focus,
-input[type="reset"]:focus,
-input[type="button"]:focus {
-color: #333;
-border-color: #888;
-outline: 0; }
-.button.button-primary,
-button.button-primary,
-input[type="submit"].button-primary,
-input[type="reset"].button-primary,
-input[type="button"].button-primary {
-color: #FFF;
-background-color: #33C3F0;
-border-color: #33C3F0; }
-.button.button-primary:hover,
-button.button-primary:hover,
-input[type="submit"].button-primary:hover,
-input[type="reset"].button-primary:hover,
-input[type="button"].button-primary:hover,
-.button.button-primary:focus,
-button.button-primary:focus,
-input[type="submit"].button-primary:focus,
-input[type="reset"].button-primary:focus,
-input[type="button"].button-primary:focus {
-color: #FFF;
-background-color: #1EAEDB;
-border-color: #1EAEDB; }
-.button.button-warning,
-button.button-warning,
-input[type="submit"].button-warning,
-input[type="reset"].button-warning,
-input[type="button"].button-warning {
-color: #FFF;
-background-color: #f09e33;
-border-color: #f09e33; }
-.button.button-warning:hover,
-button.button-warning:hover,
-input[type="submit"].button-warning:hover,
-input[type="reset"].button-warning:hover,
-input[type="button"].button-warning:hover,
-.button.button-warning:focus,
-button.button-warning:focus,
-input[type="submit"].button-warning:focus,
-input[type="reset"].button-warning:focus,
-input[type="button"].button-warning:focus {
-color: #FFF;
-background-color: #f09e33;
-border-color: #f09e33; }
-.button.button-danger,
-button.button-danger,
-input[type="submit"].button-danger,
-input[type="reset"].button-danger,
-input[type="button"].button-danger {
-color: #FFF;
-background-color: #c74f4f;
-border-color: #c74f4f; }
-.button.button-danger:hover,
-button.button-danger:hover,
-input[type="submit"].button-danger:hover,
-input[type="reset"].button-danger:hover,
-input[type="button"].button-danger:hover,
-.button.button-danger:focus,
-button.button-danger:focus,
-input[type="submit"].button-danger:focus,
-input[type="reset"].button-danger:focus,
-input[type="button"].button-danger:focus {
-color: #FFF;
-background-color: #c74f4f;
-border-color: #c74f4f; }
-
-input[type="email"],
-input[type="number"],
-input[type="search"],
-input[type="text"],
-input[type="tel"],
-input[type="url"],
-input[type="password"],
-textarea,
-select {
-height: 38px;
-padding: 6px 10px; 
-background-color: #fff;
-border: 1px solid #D1D1D1;
-border-radius: 4px;
-box-shadow: none;
-box-sizing: border-box; }
-input[type="email"],
-input[type="number"],
-input[type="search"],
-input[type="text"],
-input[type="tel"],
-input[type="url"],
-input[type="password"],
-textarea {
--webkit-appearance: none;
- -moz-appearance: none;
-appearance: none; }
-textarea {
-min-height: 65px;
-padding-top: 6px;
-padding-bottom: 6px; }
-input[type="email"]:focus,
-input[type="number"]:focus,
-input[type="search"]:focus,
-input[type="text"]:focus,
-input[type="tel"]:focus,
-input[type="url"]:focus,
-input[type="password"]:focus,
-textarea:focus,
-select:focus {
-border: 1px solid #33C3F0;
-outline: 0; }
-label,
-legend {
-display: block;
-margin-bottom: .5rem;
-font-weight: 600; }
-fieldset {
-padding: 0;
-border-width: 0; }
-input[type="checkbox"],
-input[type="radio"] {
-display: inline; }
-label > .label-body {
-display: inline-block;
-margin-left: .5rem;
-font-weight: normal; }
-
-ul {
-list-style: circle inside; }
-ol {
-list-style: decimal inside; }
-ol, ul {
-padding-left: 0;
-margin-top: 0; }
-ul ul,
-ul ol,
-ol ol,
-ol ul {
-margin: 1.5rem 0 1.5rem 3rem;
-font-size: 90%; }
-li {
-margin-bottom: 1rem; }
-
-code {
-padding: .2rem .5rem;
-margin: 0 .2rem;
-font-size: 90%;
-white-space: nowrap;
-background: #F1F1F1;
-border: 1px solid #E1E1E1;
-border-radius: 4px; }
-pre > code {
-display: block;
-padding: 1rem 1.5rem;
-white-space: pre; }
-
-th,
-td {
-padding: 12px 15px;
-text-align: left;
-border-bottom: 1px solid #E1E1E1; }
-th:first-child,
-td:first-child {
-padding-left: 0; }
-th:last-child,
-td:last-child {
-padding-right: 0; }
-
-button,
-.button {
-margin-bottom: 1rem; }
-input,
-textarea,
-select,
-fieldset {
-margin-bottom: 1.5rem; }
-pre,
-blockquote,
-dl,
-figure,
-table,
-p,
-ul,
-ol,
-form {
-margin-bottom: 2.5rem; }
-
-.u-full-width {
-width: 100%;
-box-sizing: border-box; }
-.u-max-full-width {
-max-width: 100%;
-box-sizing: border-box; }
-.u-pull-right {
-float: right; }
-.u-pull-left {
-float: left; }
-
-hr {
-margin-top: 3rem;
-margin-bottom: 3.5rem;
-border-width: 0;
-border-top: 1px solid #E1E1E1; }
-
-
-.container:after,
-.row:after,
-.u-cf {
-content: "";
-display: table;
-clear: both; }
-
-
-
-@media (min-width: 400px) {}
-
-@media (min-width: 550px) {}
-
-@media (min-width: 750px) {}
-
-@media (min-width: 1000px) {}
-
-@media (min-width: 1200px) {}
-
-)=====";
+const char* const data_skeleton_css_etag PROGMEM = "\"f4e45c4a9a9bb3be\"";
+const size_t data_skeleton_css_len = 1803;
+const uint8_t data_skeleton_css[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x59,0xdd,0x8f,0xab,0x36,0x16,0xff,0x57,0xa2,0xa9,0x46,0xda,0x95,0x0c,0x22,0x24,0x30,0x19,0xd0,0x56,0x7b,
+0xb7,0xbd,0xa3,0x3e,0xf5,0xa1,0xaf,0x55,0x1f,0x1c,0x30,0xc1,0xba,0x0e,0xb0,0xc6,0xdc,0xcc,0x34,0xe2,0x7f,0xef,0x01,0x9b,0x80,0x8d,0x9d,0x49,0xdf,0x3a,0x91,0x26,
+0xf1,0xf9,0xe2,0x7c,0xfc,0x6c,0xce,0x01,0x3f,0xab,0x2b,0x81,0x69,0x45,0xf8,0xb5,0xa9,0x5b,0x2a,0x68,0x5d,0x25,0x9c,0x30,0x2c,0xe8,0x77,0x92,0x5e,0x68,0x2e,0xca,
+0x64,0x1b,0x04,0xcf,0xe9,0x19,0xbf,0x7b,0x72,0xf9,0x1a,0x07,0xcd,0x3b,0xac,0xf9,0x89,0x56,0x49,0xb0,0xc1,0x9d,0xa8,0xd3,0x06,0xe7,0x39,0xad,0x4e,0xb0,0x0c,0x07,
+0xe6,0xb1,0x7e,0xf7,0x5a,0xfa,0xe7,0x40,0x39,0xd6,0x3c,0x27,0xdc,0x03,0x4a,0xef,0x67,0x35,0xeb,0xce,0x15,0x52,0xdf,0xed,0x75,0x61,0xbe,0x60,0x35,0x16,0x09,0x23,
+0x85,0x70,0x28,0xff,0xf7,0x4c,0x72,0x8a,0x37,0xff,0x3a,0xd3,0x4a,0xf9,0xb1,0x0f,0xe0,0x52,0xff,0xbe,0xfa,0x73,0x00,0x92,0x7e,0x88,0x9e,0x67,0x7f,0x7a,0x8b,0x62,
+0x14,0x39,0x14,0x83,0xe7,0xb5,0x8f,0x32,0x4e,0x6f,0xf0,0x2c,0xd9,0xdf,0xf8,0x49,0x41,0x79,0x2b,0xbc,0xac,0xa4,0x2c,0xbf,0xc9,0x2e,0x89,0x9a,0x5e,0xd0,0xfb,0x75,
+0x45,0x6e,0xa6,0xe7,0xdf,0x53,0x0a,0xf6,0x7e,0x7c,0xfb,0x7b,0x81,0x8b,0x88,0x4b,0x6d,0x26,0x69,0xe7,0xef,0x6e,0x7f,0x83,0x44,0xc9,0x89,0x69,0x25,0x0c,0x81,0x51,
+0xd4,0x1d,0x37,0xe8,0xbb,0xc0,0xd7,0xac,0x17,0x50,0x5a,0x53,0xe4,0x55,0x37,0xdf,0xd2,0x77,0xd3,0xc5,0xc3,0x40,0x26,0xdf,0x49,0x65,0x30,0xa2,0x58,0xb7,0x4e,0xe8,
+0xa9,0x14,0x86,0x4c,0x1c,0xe9,0xe6,0x2b,0xba,0x4a,0xc1,0xcb,0xde,0x1f,0xd2,0x2f,0x56,0xf6,0x0f,0xa1,0x61,0x9f,0x59,0x9c,0x78,0xdd,0x1a,0xe9,0xb9,0x10,0xb6,0x0a,
+0x52,0xe1,0xd8,0xac,0x8b,0x27,0x4a,0xca,0x73,0x25,0xeb,0x48,0x19,0x14,0x44,0x8a,0xb5,0xba,0x9c,0x19,0xd8,0x60,0xae,0xc4,0xac,0xd0,0xa5,0xc6,0xdc,0xd5,0x45,0xd1,
+0x12,0xe1,0x1d,0x3f,0x3c,0x0d,0x0b,0x16,0xaa,0x0e,0xba,0x83,0x81,0x8d,0x59,0x63,0x46,0x09,0xb2,0x52,0x75,0x3b,0xdb,0x17,0xc3,0xd5,0x59,0x63,0x81,0x25,0xe4,0xa0,
+0xeb,0xb6,0xc2,0x58,0x33,0xb0,0xc0,0x1c,0xb2,0x93,0x75,0xf5,0xdd,0xde,0x77,0x84,0xb4,0x80,0x26,0xb2,0x93,0x8d,0x1d,0xb9,0x73,0x05,0x35,0x23,0x18,0x59,0xa9,0xba,
+0x9d,0x28,0xd4,0x95,0x17,0x10,0x43,0x0e,0xba,0x6e,0x20,0x0e,0x5c,0x21,0x2d,0xf7,0x03,0x72,0xd0,0x0d,0x5b,0xaf,0xae,0xa0,0x16,0xfb,0x06,0xd9,0xc9,0xba,0xa5,0x97,
+0xc3,0xb8,0xa9,0x16,0x25,0xb5,0x86,0x25,0x1c,0x41,0x1d,0x62,0x67,0x50,0xcc,0x91,0x21,0x63,0x77,0x2e,0xad,0xbd,0x46,0xae,0xb0,0xcc,0x4d,0x88,0xee,0xf0,0x1e,0x45,
+0xd2,0x6a,0xc7,0xa2,0x7b,0xcc,0x47,0x0b,0x60,0xec,0x6f,0xe4,0x66,0xad,0xf1,0xd5,0x97,0xe2,0xcc,0xae,0x05,0xdc,0x74,0x86,0xdb,0x1b,0x49,0xe2,0xd0,0x8f,0x9e,0xfb,
+0x63,0x9d,0x7f,0x2c,0x88,0x5b,0x3f,0x22,0xe7,0x94,0xd1,0xc1,0xd8,0x88,0x10,0xa0,0xc4,0xe9,0xc8,0xbf,0xc8,0x35,0xdc,0xf6,0xe4,0xba,0xc0,0x67,0xca,0x3e,0x92,0xa7,
+0xdf,0x30,0x23,0x17,0xfc,0xf1,0x84,0x9e,0x7e,0x19,0x0e,0x3d,0x41,0x33,0xfc,0x2b,0xe9,0xc8,0x72,0xbd,0x91,0x84,0xdb,0x1a,0x7d,0xe1,0x14,0x33,0xd4,0xe2,0xaa,0x05,
+0x4c,0x73,0x5a,0xa4,0xe0,0x74,0xcd,0x93,0x1f,0xc2,0x30,0xec,0xcb,0x2d,0x2a,0x43,0x54,0xee,0x50,0xb9,0x47,0x65,0x84,0xca,0x78,0x8a,0x44,0xd4,0x4d,0x12,0x4c,0x07,
+0xe8,0xb1,0x16,0xa2,0x3e,0x27,0x21,0x07,0x77,0x97,0xee,0xed,0x82,0x00,0x2c,0x2c,0x22,0x82,0x73,0x9d,0xaf,0x42,0x0a,0x53,0x46,0x84,0x80,0x5b,0x7b,0xdb,0xe0,0x6c,
+0xb8,0x51,0x7b,0xfe,0x16,0xa4,0xfa,0x32,0x5c,0x68,0xee,0xfc,0xd8,0xa2,0x19,0xb9,0x54,0x77,0x9a,0xaa,0xe5,0xa2,0x3b,0x97,0xe6,0x7e,0xa1,0x19,0xfa,0x7b,0x8b,0xa6,
+0xe5,0xa2,0xc1,0x61,0xd4,0x8d,0xb4,0xe2,0x1d,0xd6,0xba,0x36,0xd5,0x68,0x54,0x8d,0xf5,0xba,0x73,0x4b,0xe1,0x0d,0xd5,0xc0,0xdd,0xcd,0x68,0x39,0x8f,0xc6,0xf0,0xf5,
+0x6c,0xee,0xfd,0xd0,0x92,0xa6,0x78,0x95,0x80,0x9d,0xd2,0x8d,0x56,0x49,0xb1,0x79,0xdc,0xf7,0x8d,0x06,0x8f,0x1e,0x5f,0x15,0x94,0xb6,0x5f,0xbf,0x7c,0xfd,0xf9,0x7f,
+0x3d,0x4e,0xca,0xfa,0x3b,0xb4,0x58,0x8a,0x1a,0xbc,0x7d,0x09,0x7e,0xfa,0xda,0xfb,0xc7,0x0e,0xe0,0x53,0x21,0xf5,0x45,0xab,0xa6,0x13,0xbf,0x8b,0x8f,0x86,0xfc,0xe7,
+0xa9,0xed,0x8e,0x67,0x2a,0x9e,0xfe,0xd0,0x88,0x9c,0xc0,0x2e,0x33,0x68,0x52,0xf7,0xe9,0x8f,0x6b,0x4e,0xdb,0x86,0xe1,0x8f,0x84,0x56,0x63,0xfa,0x8e,0xac,0xce,0xbe,
+0xa5,0x2a,0x89,0xbb,0x03,0xb4,0xa3,0x73,0x77,0x1a,0xc1,0x4a,0x79,0x12,0x45,0x51,0x2a,0xc8,0xbb,0xf0,0x30,0xa3,0xa7,0x2a,0xc9,0x48,0x05,0x99,0x4e,0x17,0xf1,0x6d,
+0x41,0x76,0x89,0xec,0x18,0x36,0xde,0xb2,0x3e,0xa3,0x69,0xa3,0x40,0x23,0xa0,0xa4,0x59,0xc1,0x61,0x77,0x15,0x35,0x3f,0x27,0x5d,0xd3,0x10,0x9e,0xe1,0x96,0x48,0x46,
+0x4e,0xb2,0x9a,0xe3,0xb1,0xd1,0xae,0xe0,0xd0,0x48,0x2f,0x25,0x15,0x64,0xb4,0x40,0x80,0x70,0xe1,0xb8,0x49,0x8f,0x38,0xfb,0x76,0xe2,0x75,0x57,0xe5,0x9e,0xf4,0x76,
+0x34,0xd6,0x60,0x0e,0x4e,0xa6,0xaa,0x29,0xe6,0x38,0xa7,0x5d,0x9b,0xec,0xc7,0x76,0x7b,0xa0,0x24,0xe0,0xf0,0xa6,0xad,0x19,0xcd,0x37,0x3f,0x1c,0x8f,0xc7,0x34,0xeb,
+0x78,0x0b,0xaa,0x4d,0x4d,0xc7,0xc8,0x1c,0x3d,0xb9,0xcc,0xa2,0x2c,0x12,0xd2,0x16,0xb6,0xa2,0x58,0x58,0xaa,0x34,0x16,0xce,0x54,0x20,0xc5,0x9a,0x2e,0x55,0xd4,0x59,
+0xd7,0x22,0x6d,0x61,0xbd,0xd4,0x9a,0x35,0x5d,0x6a,0xcd,0xb9,0x5d,0x6a,0x64,0x4d,0x60,0x83,0xd3,0x7b,0xca,0x96,0xa2,0x1c,0x0e,0x87,0xb4,0xee,0xc4,0x50,0xc6,0xa1,
+0xfb,0x93,0x6a,0xea,0xcb,0x6b,0x38,0x05,0x28,0x7f,0x20,0x3b,0xd5,0xe6,0xe3,0x3d,0x19,0xe5,0xec,0x3d,0x91,0xc9,0x6b,0x43,0x66,0x72,0xff,0xed,0xed,0x6d,0x8d,0x04,
+0x08,0xea,0xa7,0xdd,0x5b,0x60,0xc4,0x25,0x89,0x8e,0x80,0xb4,0xe2,0xda,0x79,0x0f,0x04,0xe7,0x2e,0xfd,0xe7,0x82,0x8e,0x40,0x75,0x60,0x98,0xcc,0x25,0x4e,0xec,0xbc,
+0x47,0xbc,0x76,0xa2,0xe8,0x73,0x41,0x97,0xd7,0x1a,0xc6,0xec,0x45,0x92,0x87,0x9f,0x51,0x24,0x75,0x22,0x1a,0xe1,0x5e,0x30,0x87,0xfe,0xed,0x84,0xec,0xd4,0x7b,0x21,
+0xda,0x64,0x8c,0xe0,0x6c,0x22,0x66,0x58,0x4a,0xe6,0x7e,0x40,0x45,0xf0,0x4a,0x56,0xbb,0x49,0x12,0x1d,0x01,0x59,0x51,0xa7,0xf3,0x1e,0x08,0xee,0x73,0xd4,0xb9,0x05,
+0x1d,0x81,0xda,0x51,0x37,0x31,0x6d,0xa8,0xd3,0x79,0x8f,0x78,0xfd,0x29,0xea,0xdc,0x82,0x2e,0xaf,0x1f,0x40,0xdd,0xdf,0x28,0x52,0x8e,0xab,0xd3,0xaa,0x3a,0x8a,0x78,
+0x2f,0x40,0x8b,0x88,0x11,0x99,0x45,0xc2,0x0c,0x49,0x8a,0xdc,0x8f,0x25,0x7b,0xd9,0x17,0xfb,0xc2,0x88,0x45,0x12,0xed,0xb1,0x58,0xf1,0xa6,0xb1,0x3e,0x8f,0xeb,0x73,
+0xb4,0x39,0xe5,0xec,0x31,0xda,0xb1,0xa6,0x78,0x36,0xa8,0x69,0xac,0x07,0x1c,0xfe,0x14,0x68,0x4e,0x39,0x87,0xc3,0x0f,0xc0,0xec,0x5e,0x69,0x96,0x57,0x20,0x67,0x4c,
+0x99,0xd1,0xb4,0x55,0xdd,0xf9,0x48,0xb8,0x41,0x6c,0x09,0xe6,0x59,0x69,0x10,0x87,0x5e,0x69,0x45,0x32,0xcd,0x75,0xdc,0xa4,0x34,0xb8,0x6d,0x2f,0xe0,0x19,0x90,0x07,
+0x0b,0xd0,0x32,0x61,0xd4,0xc2,0x54,0x9a,0x89,0xab,0xad,0x25,0x8c,0xa1,0x67,0xda,0x8e,0x8f,0x2c,0xd7,0xbb,0xa9,0x28,0x2c,0x9d,0xd5,0xcf,0xdb,0xe1,0x63,0x6d,0xc2,
+0xa0,0xbf,0x2a,0x71,0x5e,0x5f,0x64,0x5b,0x67,0xef,0xb7,0xfe,0x89,0xf9,0xb9,0x42,0x87,0x7b,0xfc,0x46,0xa1,0x13,0x86,0x46,0x15,0x43,0xa7,0x39,0x36,0xa2,0x10,0x82,
+0x77,0xae,0xff,0x5c,0x11,0x8d,0x75,0x7f,0xb3,0x32,0x8c,0x24,0x2a,0xc5,0x71,0x34,0xa7,0x78,0x9c,0x0b,0xe2,0xc5,0x5a,0x4d,0x8e,0x40,0xb2,0x65,0xc3,0x82,0xd4,0x29,
+0x27,0xb6,0x5d,0xa1,0x32,0x63,0x61,0xc9,0xfc,0x58,0x19,0xf6,0xcb,0x8c,0xb9,0xb2,0xd0,0xe7,0x8c,0x29,0xe6,0x14,0xb1,0x5a,0x4a,0x74,0xa9,0x8d,0xb3,0x06,0x8c,0xea,
+0xd7,0xe6,0xae,0x93,0xe1,0x23,0x61,0x88,0x91,0x13,0xa9,0xf2,0xdb,0xec,0x22,0x87,0x16,0x7d,0xb6,0x96,0x23,0xa1,0x31,0x82,0xf4,0x05,0x25,0x2c,0x87,0x2d,0x7e,0xbd,
+0x4d,0x35,0x13,0x18,0xe5,0x3c,0x18,0x68,0x59,0xcd,0x4a,0x92,0x7d,0x03,0xe0,0x99,0xf3,0x14,0xe0,0xb6,0x5e,0x8d,0x4e,0xd2,0xb5,0x1f,0xfd,0xf1,0xcb,0x1b,0x9f,0x4c,
+0x58,0x67,0xab,0xe5,0x93,0x8d,0xb5,0x93,0x15,0xcc,0x3c,0x98,0xf5,0x1d,0xbb,0x32,0xda,0xc2,0x30,0x25,0x3e,0x18,0x49,0x32,0xca,0x33,0x46,0x36,0xb4,0x6a,0x69,0x4e,
+0xfa,0x5a,0xe3,0xc1,0x40,0x04,0x8d,0x15,0x9b,0x99,0x08,0x74,0x27,0xb4,0xc8,0x07,0xb5,0xa9,0x36,0x63,0x76,0x6c,0xd3,0x0d,0x42,0x1b,0x10,0xad,0xa7,0xff,0xa0,0xa3,
+0xde,0x49,0xc8,0xc9,0x74,0x13,0x6c,0xd4,0x8f,0xdd,0xcd,0xc3,0x71,0xb0,0x7b,0x0d,0x9e,0x7b,0x46,0xaf,0x7a,0xae,0xc7,0x07,0x01,0x59,0x9d,0x93,0x5b,0x5a,0xc7,0x71,
+0x79,0x23,0xc3,0xbb,0xbd,0xec,0xf0,0xc3,0x95,0xad,0xfb,0xf3,0x1b,0x9c,0xa1,0xdb,0xe1,0x63,0x39,0x49,0xbe,0x6e,0x87,0xcf,0xfa,0x24,0xe9,0x1b,0x4e,0x7e,0x1c,0x5d,
+0xd1,0xc1,0x31,0x39,0x36,0xb8,0xaa,0x42,0xd3,0xae,0x0d,0x6a,0xbd,0x28,0x91,0xc8,0x6f,0x21,0x6c,0xc3,0xe1,0x74,0x1b,0xf6,0xe2,0x62,0xd0,0x55,0xef,0x58,0xd4,0x89,
+0x24,0x83,0x37,0x9d,0x02,0x3b,0xda,0x1b,0x0e,0x91,0x6b,0xef,0x36,0xf4,0xda,0x0c,0xc2,0x0c,0x2f,0x65,0xe7,0xd5,0x4d,0x94,0x8f,0xd0,0x08,0x7a,0x35,0xf0,0xab,0x9b,
+0x8e,0xad,0x08,0x23,0x4c,0xcd,0xb3,0x1b,0xdd,0x50,0x6f,0x68,0xc8,0x87,0x10,0x10,0x3a,0x1a,0x93,0xf4,0xff,0xae,0x16,0x04,0xe5,0x0c,0xe4,0x4f,0x1d,0x10,0x05,0x3e,
+0x32,0x82,0x1a,0xc0,0x0a,0x40,0x04,0x0d,0xd3,0xb8,0x61,0x20,0x94,0x06,0xfc,0xce,0x2b,0x3a,0xc6,0xe4,0x16,0x5a,0xbe,0x2e,0x70,0x4c,0xcd,0x9d,0x37,0xbc,0x0f,0x5b,
+0xa8,0xcc,0xaf,0xc7,0xee,0xab,0x35,0x83,0xca,0x98,0x8c,0xab,0x7c,0xe5,0x35,0xfe,0xbe,0x71,0x86,0x8c,0x5e,0xe7,0x77,0x61,0x7d,0xc9,0x97,0x4f,0x57,0x76,0x33,0x16,
+0x27,0xff,0x77,0x12,0x07,0xfa,0x09,0x30,0x2d,0x07,0x9d,0x75,0x6d,0xe7,0xf7,0x5e,0x09,0x2e,0xc4,0xd0,0x9d,0x70,0xb8,0x67,0xa9,0x9f,0x9d,0x97,0x15,0xd7,0x41,0x80,
+0x54,0x22,0x79,0x7a,0x4a,0x27,0x08,0x8e,0x89,0x4c,0x61,0x0b,0x63,0x0e,0x11,0x89,0xd2,0xfd,0x3e,0xce,0xfd,0x88,0xca,0xc2,0x79,0x71,0x72,0x20,0x8d,0x4e,0x56,0xa8,
+0x58,0x7f,0x01,0x13,0x02,0x46,0x49,0xbc,0x1c,0x00,0x00
+};
 
 // /style.css
 const char* const data_style_css_path PROGMEM = "/style.css";
-const char data_style_css[] PROGMEM = R"=====(
-hr {
-margin-top: 2rem;
-margin-bottom: 2.5rem;
-border-width: 0;
-border-top: 1px solid #E1E1E1;
-}
-.logo {
-margin-top: 20px;
-margin-left: 40px;
-position: fixed;
-top: 0;
-left: 0;
-z-index: 999;
-font-weight: bolder;
-}
-#header {
-height: 40px;
-width: 100%;
-position: fixed;
-top: 0;
-right: 0;
-padding-top: 5px;
-background-color: #FbFbFb;
-color:#888;
-z-index: 998;
-text-align: right;
-}
-#header h5 {
-margin-right: 20px;
-margin-top: 5px;
-}
-#footer {
-height: 30px;
-width: 100%;
-position: fixed;
-bottom: 10px;
-left: 10px;
-font-size: 11px;
-color:#888;
-}
-.version {
-text-align: center;
-font-size: 11px;
-color:#888;
-}
-#sidebar {
-height: 100%;
-width: 120px;
-position: fixed;
-top: 0;
-left: 0;
-padding: 60px 5px 0 5px;
-border: 1px solid #ececec;
-border-width: 0 1px 0 0;
-z-index: 998;
-background-color: #FbFbFb;
-}
-#content {
-padding-left: 155px;
-padding-top: 70px;
-padding-right: 30px;
-}
-input[type="file"] {
-display: none;
-}
-.custom-file-upload {
-border: 1px solid #ccc;
-display: inline-block;
-padding: 6px 12px;
-cursor: pointer;
-border-radius: 4px;
-height: 25px;
-}
-.extrafunc {
-position: absolute;
-top: 30px;
-right: -10px;
-}
-.grey {
-color: #888
-}
-.text-primary {
-color: #1EAEDB;
-}
-.text-success {
-color: #60a75e;
-}
-.text-warning {
-color: #f09e33;
-}
-.text-danger {
-color: #c74f4f;
-}
-.hrborder {
-border: 1px solid #ececec;
-border-width: 0 0 1px 0;
-max-width: 80%;
-}
-input:disabled {
-background-color: #dddddd;
-}
-.w100 {
-width: 100%;
-}
-.clear {
-clear: both;
-}
-.hand {
-cursor: pointer;
-}
-.center{
-margin-left: 50%;
-}
-.hidden {
-display: none;
-}
-.inputcomment {
-color: #6e6e6e;;
-font-size: 12px;
-margin-top: -8px;
-padding-left: 5px;
-}
-/* Absolute Center Spinner */
-.loading {
-position: fixed;
-z-index: 999;
-height: 2em;
-width: 2em;
-overflow: visible;
-margin: auto;
-top: 0;
-left: 0;
-bottom: 0;
-right: 0;
-}
-/* Transparent Overlay */
-.loading:before {
-content: '';
-display: block;
-position: fixed;
-top: 0;
-left: 0;
-width: 100%;
-height: 100%;
-background-color: rgba(202,202,202,0.9);
-}
-.loading:not(:required):after {
-content: '';
-display: block;
-font-size: 10px;
-width: 1em;
-height: 1em;
-margin-top: -0.5em;
--webkit-animation: spinner 1500ms infinite linear;
--moz-animation: spinner 1500ms infinite linear;
--ms-animation: spinner 1500ms infinite linear;
--o-animation: spinner 1500ms infinite linear;
-animation: spinner 1500ms infinite linear;
-border-radius: 0.5em;
--webkit-box-shadow: rgba(0, 0, 0, 0.75) 1.5em 0 0 0, rgba(0, 0, 0, 0.75) 1.1em 1.1em 0 0, rgba(0, 0, 0, 0.75) 0 1.5em 0 0, rgba(0, 0, 0, 0.75) -1.1em 1.1em 0 0, rgba(0, 0, 0, 0.5) -1.5em 0 0 0, rgba(0, 0, 0, 0.5) -1.1em -1.1em 0 0, rgba(0, 0, 0, 0.75) 0 -1.5em 0 0, rgba(0, 0, 0, 0.75) 1.1em -1.1em 0 0;
-box-shadow: rgba(0, 0, 0, 0.75) 1.5em 0 0 0, rgba(0, 0, 0, 0.75) 1.1em 1.1em 0 0, rgba(0, 0, 0, 0.75) 0 1.5em 0 0, rgba(0, 0, 0, 0.75) -1.1em 1.1em 0 0, rgba(0, 0, 0, 0.75) -1.5em 0 0 0, rgba(0, 0, 0, 0.75) -1.1em -1.1em 0 0, rgba(0, 0, 0, 0.75) 0 -1.5em 0 0, rgba(0, 0, 0, 0.75) 1.1em -1.1em 0 0;
-}
-/* Animation */
-@-webkit-keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-@-moz-keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-@-o-keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-@keyframes spinner {
-0% {
--webkit-transform: rotate(0deg);
--moz-transform: rotate(0deg);
--ms-transform: rotate(0deg);
--o-transform: rotate(0deg);
-transform: rotate(0deg);
-}
-100% {
--webkit-transform: rotate(360deg);
--moz-transform: rotate(360deg);
--ms-transform: rotate(360deg);
--o-transform: rotate(360deg);
-transform: rotate(360deg);
-}
-}
-/* The Modal (background) */
-.modal {
-display: none; /* Hidden by default */
-position: fixed; /* Stay in place */
-z-index: 1; /* Sit on top */
-padding-top: 100px; /* Location of the box */
-left: 0;
-top: 0;
-width: 100%; /* Full width */
-height: 100%; /* Full height */
-overflow: auto; /* Enable scroll if needed */
-background-color: rgb(202,202,202); /* Fallback color */
-background-color: rgba(202,202,202,0.9); /* Black w/ opacity */
-}
-/* Modal Content */
-.modal-content {
-background-color: #fefefe;
-margin-left: 150px;
-margin-right: 30px;
-padding: 20px;
-border: 1px solid #888;
-}
-/* The Close Button */
-.close {
-color: #aaaaaa;
-float: right;
-font-size: 28px;
-font-weight: bold;
-}
-.close:hover,
-.close:focus {
-color: #000;
-text-decoration: none;
-cursor: pointer;
-}
-/* Start loading trick */
-#loadingStart {display: none !important;}
-#main { display: block !important; }
-)=====";
+const char* const data_style_css_etag PROGMEM = "\"47323ef40e11ae26\"";
+const size_t data_style_css_len = 1093;
+const uint8_t data_style_css[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x57,0xdd,0x6e,0xac,0x36,0x10,0x7e,0x15,0x7a,0x56,0xd1,0x49,0xa4,0x80,0xcc,0x26,0x9b,0xdd,0x18,0x55,0x6a,
+0xab,0xa6,0x2f,0xd0,0xcb,0xa3,0x5e,0x18,0x6c,0x16,0x2b,0x60,0x53,0xdb,0x9c,0x6c,0x82,0x78,0xf7,0x8e,0x8d,0x59,0x20,0x1b,0xb6,0xc9,0x91,0x2a,0xf5,0x22,0x6b,0x65,
+0xb3,0x78,0xc6,0x9e,0x99,0x6f,0x7e,0x98,0x29,0x54,0x5b,0x11,0xb5,0xe7,0x22,0x34,0xb2,0xc6,0x6b,0xc5,0xaa,0xc4,0x3f,0xa7,0xd2,0x18,0x59,0xe1,0x75,0xb4,0xb1,0x9b,
+0xa9,0x54,0x94,0xa9,0xf0,0x89,0x53,0x53,0x60,0x34,0x3c,0xda,0x33,0x71,0x7d,0x08,0xb4,0x2c,0x39,0x0d,0x56,0x0f,0xb1,0x5d,0x5d,0x54,0xca,0xbd,0x9c,0x5d,0x8b,0xea,
+0xc3,0x70,0x6d,0xc9,0x72,0x83,0x6f,0xed,0x46,0x2d,0x35,0x37,0x5c,0x0a,0x9c,0xf3,0x03,0xa3,0x89,0x65,0x44,0x89,0x23,0xa3,0xe4,0x25,0xe4,0x82,0xb2,0x03,0xbe,0xbf,
+0xbf,0x4f,0x72,0x29,0x4c,0xf8,0xc4,0xf8,0xbe,0x30,0x38,0x95,0x25,0xc8,0xed,0x56,0x05,0x23,0xf0,0xbf,0x2d,0xfa,0x5d,0x77,0x5d,0xaf,0x5a,0x8c,0xd0,0xc5,0xdb,0x37,
+0x2b,0xc7,0x8a,0x92,0x9a,0x50,0xca,0xc5,0xde,0x29,0xb6,0x81,0x73,0x29,0xc9,0x1e,0xf7,0x4a,0x36,0x82,0x86,0x99,0x2c,0xa5,0xc2,0xab,0x3f,0x52,0xbb,0x12,0xff,0xb4,
+0xdb,0xed,0x26,0xea,0xec,0x12,0xc3,0x0e,0x26,0x24,0x25,0xdf,0x0b,0xec,0xae,0x1c,0x94,0x09,0x8a,0xcd,0x60,0x73,0x2f,0x6a,0x6a,0xb5,0x17,0xd6,0xad,0x72,0x29,0xcd,
+0xa8,0xf8,0xcd,0x79,0xc5,0xbd,0x0b,0x62,0xcb,0xe5,0x80,0x71,0xbf,0x1c,0x1e,0x9a,0xbf,0x30,0x1c,0x03,0xf6,0x13,0x35,0xbb,0xe8,0x3b,0x53,0x1a,0x8e,0xb7,0x13,0x1d,
+0x33,0x26,0x40,0xe0,0x99,0x43,0x2b,0xcd,0x29,0x4b,0xc9,0x51,0x27,0xa7,0x88,0xd7,0x69,0xfd,0x6f,0x7e,0xf2,0x60,0xe2,0x3b,0x60,0x0c,0xc0,0xc0,0x00,0x05,0x0e,0x53,
+0x17,0x1e,0xd3,0xd0,0x60,0x99,0x5d,0xaf,0xc2,0x28,0x88,0xdd,0x09,0x34,0xc3,0x77,0xc9,0x1f,0xdd,0x2a,0x03,0x1b,0xc0,0x9a,0x76,0xf0,0x60,0x0f,0xc9,0xc6,0x0a,0x9c,
+0x3a,0x75,0x8b,0x26,0x1b,0xea,0x88,0x73,0xc7,0x45,0xdd,0x98,0x6f,0xe6,0xb9,0x66,0x3f,0x7f,0xc9,0x79,0xc9,0xbe,0xfc,0xd5,0x52,0xae,0xeb,0x92,0x3c,0x63,0x21,0x05,
+0xeb,0xa2,0xac,0xd1,0x00,0x77,0x68,0x69,0x61,0x53,0x97,0x92,0xd0,0xf6,0xd4,0x90,0x2c,0xcb,0x92,0xe1,0x18,0x17,0x25,0x17,0x2c,0x4c,0x4b,0x99,0x3d,0x8e,0x50,0x00,
+0x6f,0xbc,0xb6,0x18,0x37,0x4a,0x83,0xfa,0xb5,0xe4,0xce,0x03,0xde,0x74,0x45,0x28,0x6f,0x34,0xbe,0x05,0x06,0x0f,0xf8,0xda,0x06,0x46,0x04,0x1e,0x53,0x24,0x6f,0x44,
+0xd6,0x1e,0xf1,0x26,0x29,0xc8,0x6c,0x0c,0x73,0x90,0xbb,0x50,0xe9,0xad,0x09,0x6d,0x18,0x74,0xd1,0x5e,0xb1,0xe7,0x76,0xea,0x7d,0xe7,0xf5,0x5a,0x71,0x88,0xb9,0x23,
+0x21,0x7e,0xf8,0xf5,0xe1,0xf7,0xdf,0x3c,0x4d,0x37,0x59,0xc6,0xb4,0x1e,0x68,0x77,0x88,0x6c,0x37,0xcc,0xd3,0x9e,0x88,0x12,0xa0,0xfe,0x40,0xcb,0xd1,0x3d,0xbb,0xb9,
+0xf1,0x34,0x4a,0xc4,0x1e,0x82,0xd6,0x93,0xb2,0xed,0x6d,0x7e,0x9b,0x77,0x51,0xa1,0x7a,0x93,0xda,0xf7,0x7a,0xdb,0xfb,0x1b,0x72,0xe2,0xe0,0xf7,0x76,0xe8,0xa2,0x77,
+0x0b,0x06,0x48,0x49,0x5a,0x32,0x40,0xfc,0xc4,0xfd,0xd4,0x7d,0xba,0xe8,0x09,0x22,0xb3,0x1d,0x93,0x05,0xfc,0x55,0x32,0x08,0x5b,0xf7,0x0d,0x85,0xc1,0x14,0xa0,0x12,
+0x11,0xb4,0x9d,0xe3,0x0e,0x6c,0x2e,0x03,0xda,0x69,0xfd,0xd9,0xd8,0xe3,0x05,0xa7,0x94,0x89,0x57,0x31,0xe0,0xb4,0xc9,0x64,0x55,0xd9,0x40,0x1b,0x70,0x62,0x76,0x25,
+0xd3,0x1c,0x5a,0xcf,0x53,0x3b,0xdc,0x4d,0x42,0xae,0x97,0x60,0x3d,0x64,0x43,0xc8,0x62,0xfa,0x2a,0x83,0xa6,0xc5,0x6d,0x88,0x01,0x28,0xb1,0xbd,0x69,0xf6,0x97,0x84,
+0x3c,0xce,0x4b,0xf9,0x84,0xbf,0x73,0xcd,0x01,0x15,0x2f,0x0a,0x93,0xc6,0xc8,0x79,0xfe,0xf9,0x0a,0x71,0xac,0x6e,0x47,0x99,0x38,0x65,0xb9,0x54,0xac,0xf5,0x39,0x83,
+0xbf,0x7e,0x3d,0x46,0xad,0x0f,0xd7,0x33,0x59,0x3d,0xa9,0x48,0xd3,0xa2,0x70,0xe2,0x1a,0xb5,0x4f,0xc9,0xe5,0x1a,0xad,0xaf,0x87,0x3f,0x14,0xdd,0x5f,0x8d,0x2a,0x08,
+0x69,0x2e,0xb1,0x62,0x7f,0x37,0x5c,0x31,0x7a,0x85,0x49,0x6e,0x5c,0x10,0x2d,0x28,0x34,0x41,0x77,0x52,0x15,0x01,0x8d,0x41,0x85,0xf1,0xd5,0xe4,0x20,0x47,0xd1,0x06,
+0x76,0xe0,0xc5,0x90,0x3e,0x72,0x28,0x76,0x02,0xc2,0xde,0xd9,0xa3,0x6b,0x2e,0x04,0x94,0xe3,0x78,0x83,0x50,0xa5,0x03,0x2e,0x72,0x2e,0xb8,0x61,0x81,0x4d,0x55,0xa2,
+0x92,0xb0,0x92,0x2f,0x1f,0xe1,0xd6,0x1f,0x60,0x96,0xef,0xe7,0x7d,0x37,0xe3,0xbc,0x6c,0xcc,0x8d,0x4e,0xe5,0x21,0xd4,0x05,0xa1,0x10,0x29,0xce,0x15,0xe8,0xda,0xad,
+0x68,0xbb,0xb9,0x0a,0x62,0xcb,0x69,0x8b,0x6b,0x80,0xae,0xdf,0x20,0x02,0x9a,0xfe,0xfb,0x4d,0x06,0x34,0x9e,0x3f,0x25,0x86,0x67,0x8f,0xf7,0x0c,0x0b,0xc2,0xc7,0xd3,
+0xe1,0x59,0xe9,0xe1,0x19,0xf1,0xaf,0xcf,0x27,0xff,0x4b,0x18,0xb6,0x67,0x71,0xd8,0xfe,0x17,0x40,0x74,0xbf,0x0c,0x81,0xf1,0xc8,0x9e,0x73,0x45,0x2a,0xa6,0x03,0x1f,
+0x5d,0x2d,0xba,0x68,0x07,0x22,0xbc,0x67,0x84,0x86,0xe2,0x50,0x61,0x25,0x0d,0x31,0xec,0x12,0x51,0xb6,0xbf,0xea,0x13,0x63,0x91,0xa6,0x17,0x49,0x72,0x89,0xf2,0xf6,
+0x76,0x67,0x4b,0xc9,0xb2,0x2e,0x37,0x77,0xe7,0xb4,0x19,0xa9,0xfa,0x0c,0x51,0x2e,0xd3,0x96,0x08,0x1d,0x60,0x67,0x25,0x7e,0x02,0xf7,0x03,0xc0,0xc9,0x4f,0xd8,0x7e,
+0x00,0xb6,0x4f,0xcc,0x3e,0x8c,0x59,0x54,0x49,0x4a,0xca,0x59,0xc7,0x96,0x2c,0xf4,0x56,0xf1,0x6c,0x24,0x00,0x7b,0x86,0x11,0x0a,0xf9,0x56,0x67,0xa1,0xc7,0x39,0xb6,
+0x5e,0xae,0xd7,0x7a,0xab,0xe3,0x99,0x36,0x3c,0x57,0xef,0xee,0x89,0x9c,0xe6,0xe1,0x30,0xc1,0x9c,0x36,0xb9,0x39,0xb3,0x6b,0x36,0x24,0x43,0x43,0x30,0x76,0x99,0xe3,
+0x1c,0x73,0x1c,0x34,0xdc,0x70,0x76,0xda,0x7b,0xbb,0x51,0x20,0x2b,0xa5,0x66,0x43,0xff,0x4a,0xdc,0x27,0x01,0xb3,0x88,0xe9,0x67,0xd6,0x49,0xb3,0xb5,0xde,0x0d,0x23,
+0xe5,0x64,0xc4,0xf6,0x17,0xe0,0xc2,0xc2,0x71,0xed,0x1f,0x72,0x09,0x03,0xd2,0x70,0x27,0x42,0xa8,0x9f,0x84,0x29,0xcb,0xa4,0xea,0x3b,0x19,0xe7,0x8f,0x57,0xdd,0xf7,
+0xca,0x37,0x83,0x7f,0x1a,0xa2,0xcc,0xcc,0x73,0xc1,0x4f,0xbc,0xaa,0xa5,0x32,0x44,0xc0,0x08,0x5d,0x11,0x3e,0x76,0xe2,0xae,0x1f,0x9c,0x92,0xff,0x01,0x70,0x1d,0x8a,
+0xfc,0xa5,0x10,0x00,0x00
+};
 
 // /update.
 const char* const data_update_html_path PROGMEM = "/update.";
-const char data_update_html[] PROGMEM = R"=====(
-<!DOCTYPE HTML><html>
-<head>
-<meta http-equiv="Content-Type" content="text/html; charset=utf-8" />
-<meta name="viewport" content="width=device-width, initial-scale=1" />
-<meta http-equiv="Cache-Control" content="no-cache, no-store, must-revalidate" />
-<meta http-equiv="Pragma" content="no-cache" />
-<meta http-equiv="Expires" content="0" />
-<title>Blecker Administration</title>
-</head>
-<body>
-<div id="loadingStart">Loading...</div>
-<div id="main" style="display: none;">
-<div class="loading" id="loader" style="display: none;">
-<div style="margin-left: -25px">Loading...</div>
-<div>&#8230;</div>
-</div>
-<div class="logo">
-BLEcker
-</div>
-<div id="header">
-<div class="row">
-<h5><strong>BLE</strong> <i>tracker</i></h5>
-</div>
-</div>
-<div id="sidebar">
-<a class="button w100" href="/">home</a>
-<a class="button w100" href="/update">update</a>
-<!--<a class="button w100 button-danger" id="reset" href="#">reset</a>-->
-<div class="version" id="version">v1.10 - 126</div>
-<div id="footer">
-<div><a href="https://github.com/redakker/blecker" target="_blank">blecker</a></div>
-</div>
-</div>
-<div id="content">
-<div class="contaier">
-<!-- The Modal -->
-<div id="myModal" class="modal" style="display: none;">
-<!-- Modal content -->
-<div class="modal-content">
-<span class="close">&times;</span>
-<p>Some text in the Modal..</p>
-</div>
-</div>
-<p id="support-notice">Please browse your update file from your device.<br />
-Check for newer update files on <a href="https://github.com/redakker/blecker" target="blank">https://github.com/redakker/blecker</a> website.</p>
-<p class="text-danger" id="error" style="display: none;">The chosen file is probably not a valid update file.</p>
-<form action="/upgrade" method="post" enctype="multipart/form-data" id="form-id">
-<label for="file-upload" id="custom-file-upload" class="custom-file-upload" onclick="getFile()">
-<input id="file-id" type="file" name="our-file" onchange="getFileName(this)"/>
-<span id="fileinput" class="">Choose a file!</span>
-</label>
-<input type="button" value="Upload" id="upload-button-id" disabled="disabled" />
-<p id="upload-status"></p>
-<p id="progress"></p>
-<pre id="result"></pre>
-</form>
-</div>
-</div>
-<script type="text/javascript" src="/functions.js"></script>
-</div>
-</body>
-</html>
-
-)=====";
+const char* const data_update_html_etag PROGMEM = "\"bd9629f873ff0319\"";
+const size_t data_update_html_len = 944;
+const uint8_t data_update_html[] PROGMEM = {
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x56,0x4d,0x6f,0xdc,0x36,0x10,0xbd,0xfb,0x57,0x30,0x2c,0x10,0x24,0x40,0xb4,0xb2,0x5d,0xb8,0x08,0x6c,0x2d,
+0x81,0xc6,0x75,0xd1,0x83,0xd3,0x1a,0x88,0x7b,0xe8,0xa9,0xa0,0xa4,0x59,0x89,0x31,0x45,0xb2,0xe4,0x68,0xd7,0xfb,0xef,0x33,0x24,0xa5,0xb5,0xbc,0x89,0x91,0xa0,0x97,
+0xa5,0x38,0x9c,0xcf,0x37,0x8f,0xc3,0xad,0x5e,0xfd,0xf6,0xd7,0xf5,0xfd,0x3f,0x77,0x37,0xec,0x8f,0xfb,0x8f,0xb7,0xa2,0xea,0x71,0xd0,0xe2,0xa4,0xea,0x41,0xb6,0xb4,
+0x0c,0x80,0x92,0xf5,0x88,0xae,0x80,0xff,0x46,0xb5,0x5d,0xf3,0x6b,0x6b,0x10,0x0c,0x16,0xf7,0x7b,0x07,0x9c,0x35,0x79,0xb7,0xe6,0x08,0x8f,0x58,0x46,0xd3,0x2b,0xd6,
+0xf4,0xd2,0x07,0xc0,0xf5,0x88,0x9b,0xe2,0x3d,0x67,0xe5,0xec,0xc5,0xc8,0x01,0xd6,0x7c,0xab,0x60,0xe7,0xac,0xc7,0x85,0xed,0x4e,0xb5,0xd8,0xaf,0x5b,0xd8,0xaa,0x06,
+0x8a,0xb4,0x79,0xc7,0x94,0x51,0xa8,0xa4,0x2e,0x42,0x23,0x35,0xac,0xcf,0x16,0x6e,0x9e,0x25,0x23,0x9b,0x1e,0x8a,0x98,0x92,0xb7,0x7a,0xe1,0xd1,0xd8,0xa2,0x89,0x47,
+0xef,0x18,0x7d,0x05,0xb4,0x9e,0xbe,0x86,0x31,0x60,0xe1,0x61,0x2b,0xb5,0x6a,0x25,0xc2,0x0b,0x1e,0xef,0xbc,0xec,0x06,0xf9,0x0d,0x57,0x2f,0xe8,0xdf,0x3c,0x3a,0xe5,
+0x21,0x2c,0x0c,0x4e,0xb3,0x26,0x2a,0xd4,0x20,0x3e,0x68,0x68,0x1e,0xc0,0xb3,0x5f,0xdb,0x81,0x2a,0x0a,0xe8,0x25,0x2a,0x6b,0xaa,0x32,0x9f,0x9e,0x54,0xe5,0x04,0x73,
+0x6d,0xdb,0x3d,0x2d,0xad,0xda,0x32,0xd5,0xae,0xb9,0xb6,0xb2,0x55,0xa6,0xfb,0x84,0x92,0x80,0x12,0xb7,0x79,0xb7,0x5a,0xad,0xaa,0x92,0x34,0x16,0x7a,0x83,0x54,0x86,
+0xb3,0x80,0x7b,0xc2,0x88,0xb7,0x2a,0x38,0x2d,0xf7,0x97,0x54,0xb3,0x81,0x2b,0x3e,0xa9,0x35,0x5a,0x86,0x70,0xf0,0xc8,0x0f,0xee,0xc1,0x7f,0xc7,0x70,0x3a,0x1c,0xa4,
+0xef,0x94,0x29,0x34,0x6c,0xf0,0x92,0x15,0xe7,0x17,0xee,0xf1,0x85,0x84,0xc4,0xeb,0x9f,0xde,0x9f,0xff,0x7c,0x7a,0x35,0x8b,0x16,0xa9,0x1e,0x72,0xe8,0x2c,0x79,0xff,
+0x70,0x7b,0x13,0x31,0x39,0x39,0x2e,0x26,0x42,0x41,0x59,0x3d,0xb7,0xf1,0x76,0x17,0x25,0xfd,0x85,0xa8,0x08,0x3d,0x6b,0x3a,0x41,0xe6,0x55,0x39,0x7d,0xb3,0x4a,0x09,
+0xc2,0x34,0xba,0xab,0x4a,0x25,0x08,0xce,0x8b,0xa7,0xc8,0x47,0xee,0x83,0x6a,0xa1,0x96,0xc9,0xbf,0x9c,0xbd,0xd7,0x23,0xa2,0x35,0x6c,0x77,0x76,0x4a,0x5d,0xeb,0x3d,
+0x6c,0xd6,0xbc,0xe4,0xa2,0xb7,0x03,0x54,0xa5,0xfc,0x9e,0xe2,0xe8,0x12,0x8f,0x44,0x5e,0xb3,0xc1,0x22,0xf3,0x2d,0xf8,0x40,0xbd,0xce,0x88,0xcf,0x1b,0xb1,0x3d,0x5b,
+0x9d,0x9d,0xb2,0x82,0x9d,0x9d,0xff,0x72,0x9c,0xe0,0xc6,0x5a,0x3c,0xd4,0x2f,0x28,0x76,0x8e,0x13,0xd9,0x16,0x2e,0xcb,0xb2,0x53,0xd8,0x8f,0xf5,0xaa,0xb1,0x43,0xe9,
+0xa1,0x95,0x0f,0x54,0x73,0x59,0x67,0x7a,0x71,0x46,0x44,0xe9,0xe8,0xca,0xf1,0x7f,0x6b,0x2d,0xcd,0x03,0x17,0xd3,0x41,0x4c,0xea,0x08,0x8e,0xa3,0xa0,0x13,0x6d,0x8f,
+0x50,0x8f,0x52,0xa9,0x9e,0x9a,0x91,0xb8,0xb6,0xff,0x68,0x5b,0x19,0x6f,0x59,0xd6,0x19,0xf2,0xee,0x47,0xc8,0x97,0x54,0x8b,0x45,0xa8,0xe0,0xa4,0x39,0xc4,0xd2,0x36,
+0x10,0x8a,0xaf,0x51,0x0d,0x10,0x88,0x3d,0xf1,0x8c,0x54,0x9c,0xf8,0x44,0x6d,0x60,0x71,0xae,0xd0,0x30,0x60,0xd8,0x03,0x4b,0xf1,0x23,0xe7,0xdc,0x57,0xe5,0xb8,0xdc,
+0xe2,0xd1,0xc5,0xd1,0x52,0x18,0x8b,0x34,0x4a,0xb8,0xb8,0xd3,0x20,0x03,0xb0,0x9a,0x48,0x44,0xcb,0xde,0x8e,0x9e,0xe5,0x66,0xb1,0x8d,0xd2,0xf4,0xe3,0xed,0x90,0xa5,
+0x79,0xf6,0xac,0xaa,0xda,0xc7,0xbb,0x7b,0xdd,0x13,0x78,0x6c,0x63,0x3d,0x33,0xb0,0x83,0x67,0x36,0x81,0x11,0x0b,0xfe,0x5f,0x6b,0xa6,0xce,0xfc,0x80,0x4d,0xec,0x1a,
+0xdb,0x41,0x1d,0x14,0xc2,0x54,0xad,0x9b,0xd1,0x8a,0x78,0x14,0xad,0x34,0x5d,0x74,0x1d,0x6b,0x06,0xef,0xed,0xcb,0x57,0xf9,0x9e,0x60,0x6b,0x7a,0x02,0xd8,0xe4,0x92,
+0x55,0x60,0xce,0xdb,0x5a,0xd6,0x7a,0x4f,0x2a,0xc8,0x24,0x4b,0xf3,0x70,0x59,0xe2,0x14,0x91,0xca,0x1f,0x98,0x6c,0xe2,0xb8,0x4a,0x5c,0xef,0x3c,0xdd,0x4e,0xce,0x68,
+0x00,0xf6,0x96,0xc2,0x3a,0x1b,0x68,0x84,0x83,0x69,0x90,0xde,0x01,0xea,0xf0,0xa8,0x51,0x39,0x9a,0x56,0x65,0xb4,0xa3,0x04,0x51,0xf2,0x89,0xd4,0xb4,0x55,0x6d,0x6c,
+0xba,0x96,0x35,0xe8,0x08,0x2b,0x49,0x29,0x4e,0x31,0xba,0x38,0x87,0xb2,0x5a,0x43,0xc3,0xd9,0x0e,0xc5,0x33,0xf9,0xcc,0x8f,0x6f,0x1c,0x59,0xd3,0x68,0xd5,0x3c,0xac,
+0x39,0x21,0xfb,0x3b,0x1d,0xbc,0x79,0x1b,0x03,0x28,0xe3,0x46,0xcc,0x51,0xa3,0x32,0x45,0x65,0x39,0xbb,0xb8,0xe5,0xd3,0xfb,0x43,0xed,0x2e,0xf2,0x9e,0x9c,0xf4,0x11,
+0xc8,0x83,0x97,0x3f,0x49,0xe1,0x0d,0xf6,0x2a,0xbc,0xe5,0xe5,0x4c,0xd2,0xd9,0x5b,0xf2,0x7d,0xc8,0x89,0x8b,0xeb,0xde,0x12,0xaa,0x84,0x5f,0x3c,0x7c,0x75,0x60,0x6d,
+0x99,0x8a,0x3c,0xe4,0x92,0xc3,0xe7,0xe1,0xc1,0x23,0xd4,0x23,0x6d,0xff,0x5e,0xd4,0x9d,0x0b,0x2a,0xb2,0x46,0xca,0x98,0x3a,0x48,0xdd,0x81,0x36,0xf5,0x32,0x7d,0xe5,
+0xf7,0xc4,0x2d,0xf5,0x03,0x4a,0x1c,0x03,0x17,0x33,0x39,0xe2,0x11,0xf5,0xb5,0xa3,0x97,0xe8,0x49,0xea,0x21,0xc9,0x49,0x46,0xcd,0x49,0x52,0x9f,0x9e,0x9c,0xd8,0x92,
+0xaf,0x2e,0x50,0x68,0xbc,0x72,0x73,0xc2,0xe9,0x31,0xff,0x2c,0xb7,0x32,0x4b,0x89,0x5d,0xbe,0x21,0x12,0x6c,0x46,0x93,0xf8,0x10,0x56,0x9f,0x53,0x94,0x7c,0xba,0x70,
+0x35,0xbd,0x62,0xe9,0x7f,0x80,0xf8,0x02,0xb2,0x48,0x8c,0xd5,0x58,0x08,0x00,0x00
+};
 
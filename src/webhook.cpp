@@ -3,6 +3,7 @@
 
 #include "definitions.h"
 #include "utilities.cpp"
+#include "database.cpp"
 #include <Arduino.h>
 #include <HTTPClient.h>
 #include "log.hpp"
@@ -23,9 +24,9 @@ class Webhook {
         void setup (Database &database) {
             this -> database = &database;
 
-            if (this->database->getValueAsString(DB_WEBHOOK) != "") {
+            if (this->database->getConfig().webhook[0] != '\0') {
                 this-> webhookConfigured = true;
-                logger << "Webhook is configured with the following URL:" << this->database->getValueAsString(DB_WEBHOOK);
+                logger << "Webhook is configured with the following URL:" << this->database->getConfig().webhook;
             } else {
                 this-> webhookConfigured = false;
                 logger << "Webhook is not configured, will be not used.";
@@ -38,14 +39,11 @@ class Webhook {
         void callWebhook(Device device) {
 
             if (webhookConfigured) {
-                String baseURL = this->database->getValueAsString(DB_WEBHOOK);
+                const Config &config = this->database->getConfig();
+                String baseURL = config.webhook;
                 
-                baseURL.replace(DEVICE_WILDCARD, device.mac);
-                if (device.available) {
-                    baseURL.replace(PRESENCE_WILDCARD, getPresentString(*database, true));
-                } else {
-                    baseURL.replace(PRESENCE_WILDCARD, getPresentString(*database, false));
-                }
+                baseURL.replace(DEVICE_WILDCARD, keyToMac(device.mac));
+                baseURL.replace(PRESENCE_WILDCARD, device.available ? config.present : config.notPresent);
 
                 http.begin(baseURL); //Specify the URL
                 int httpCode = http.GET();                                        //Make the request
@@ -4,6 +4,7 @@
 #include <WebServer.h>
 #include <ArduinoOTA.h>
 #include <Update.h>
+#include <Callback.h>
 #include "database.cpp"
 #include "log.hpp"
 #include "webcontent.h"
@@ -12,6 +13,7 @@ class Webserver {
     
     Logger logger;
     Database* database;
+    Signal<JsonObject>* statsRequested;
     WebServer server;
 
     boolean networkConnected = false;
@@ -20,9 +22,10 @@ class Webserver {
         Webserver(Log& rlog) : logger(rlog, "[WEB]"), server(80) {
         }
 
-        void setup(Database &database) {
+        void setup(Database &database, Signal<JsonObject> &statsRequested) {
 
             this->database = &database;
+            this->statsRequested = &statsRequested;
 
             // -- Set up required URL handlers on the web server.
             // We should bind the member function in this way to able to pass to the request function.
@@ -36,6 +39,7 @@ class Webserver {
             //server.on("/logo.jpg", HTTP_GET, std::bind(&Webserver::handleLogo, this));
 
             server.on("/data", std::bind(&Webserver::handleData, this));
+            server.on("/stats", HTTP_GET, std::bind(&Webserver::handleStats, this));
 
             // POST
             server.on("/savedata", std::bind(&Webserver::handleSaveData, this));
@@ -53,6 +57,10 @@ class Webserver {
 
             // Favicon
             server.on("/favicon.ico", std::bind(&Webserver::handleFavicon, this));
+
+            // Revalidation of the cached web files (ETag)
+            const char* headerKeys[] = {"If-None-Match"};
+            server.collectHeaders(headerKeys, 1);
             
             server.begin();
             logger << "Webserver is ready.";
@@ -80,31 +88,45 @@ class Webserver {
             server.sendHeader("Expires","-1");
         }
 
+        // Web files are gzipped at build time (see pre_build_web.py). The browser keeps them and revalidates
+        // with the ETag, an unchanged file is answered with 304 (no body).
+        void sendContent(const char* contentType, const uint8_t* content, size_t length, const char* etag) {
+            server.sendHeader("Cache-Control", "no-cache");
+            server.sendHeader("ETag", etag);
+            if (server.header("If-None-Match") == etag) {
+                server.send(304);
+                return;
+            }
+            server.sendHeader("Content-Encoding", "gzip");
+            server.send_P(200, contentType, (PGM_P) content, length);
+        }
+
         void handleRoot() {            
             logger << "/ is called";
             server.sendHeader("Access-Control-Allow-Origin", "*");
-            sendHeaders();
-            server.send(200, "text/html", data_index_html);
+            server.enableCORS();
+            server.enableCrossOrigin();
+            sendContent("text/html", data_index_html, data_index_html_len, data_index_html_etag);
         }
 
         void handleJavaScript() {
             logger << "/function.js is called";
-            server.send(200, "text/javascript", data_functions_js);
+            sendContent("text/javascript", data_functions_js, data_functions_js_len, data_functions_js_etag);
         }
 
         void handleStyle() {
             logger << "/style.css is called";
-            server.send(200, "text/css", data_style_css);
+            sendContent("text/css", data_style_css, data_style_css_len, data_style_css_etag);
         }
 
         void handleNormalize() {
             logger << "/normalize.css is called";
-            server.send(200, "text/css", data_normalize_css);
+            sendContent("text/css", data_normalize_css, data_normalize_css_len, data_normalize_css_etag);
         }
 
         void handleSkeleton() {
             logger << "/skeleton.css is called";
-            server.send(200, "text/css", data_skeleton_css);
+            sendContent("text/css", data_skeleton_css, data_skeleton_css_len, data_skeleton_css_etag);
         }
 
         void handleLogo() {
@@ -118,6 +140,18 @@ class Webserver {
             server.send(200, "application/json", getData());
         }
 
+        // Runtime counters of the objects (queue sizes, drops, etc.)
+        void handleStats() {
+            logger << "/stats is called";
+            DynamicJsonDocument stats(STATS_JSON_SIZE);
+            statsRequested->fire(stats.to<JsonObject>());
+
+            String output;
+            serializeJson(stats, output);
+            sendHeaders();
+            server.send(200, "application/json", output);
+        }
+
         void handleFavicon() {
             logger << "/favicon is called";
             sendHeaders();
@@ -145,7 +179,7 @@ class Webserver {
 
         void handleUpdate() {
             logger << "/update is called";
-            server.send(200, "text/html", data_update_html);
+            sendContent("text/html", data_update_html, data_update_html_len, data_update_html_etag);
         }
 
         void handleUpgradeFn() {
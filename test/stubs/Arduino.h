@@ -0,0 +1,103 @@
+// Host (native) build of the platform independent sources: the part of the Arduino API what they use.
+// The ESP32 code (radio, network, web) is not built on the host.
+#ifndef ARDUINO_STUB
+#define ARDUINO_STUB
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#define PROGMEM
+#define PGM_P const char*
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+inline unsigned long micros() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() {
+    return micros() / 1000;
+}
+
+inline void yield() {
+    std::this_thread::yield();
+}
+
+inline long random(long min, long max) {
+    return min + rand() % (max - min);
+}
+
+inline long random(long max) {
+    return random(0, max);
+}
+
+inline boolean isDigit(char c) {
+    return isdigit((unsigned char) c);
+}
+
+inline boolean isHexadecimalDigit(char c) {
+    return isxdigit((unsigned char) c);
+}
+
+class String {
+
+    std::string value;
+
+    public:
+        String() {}
+        String(const char* text) : value(text != NULL ? text : "") {}
+        String(const std::string &text) : value(text) {}
+        explicit String(char c) : value(1, c) {}
+        explicit String(int number) : value(std::to_string(number)) {}
+        explicit String(unsigned int number) : value(std::to_string(number)) {}
+        explicit String(long number) : value(std::to_string(number)) {}
+        explicit String(unsigned long number) : value(std::to_string(number)) {}
+
+        unsigned int length() const { return value.size(); }
+        const char* c_str() const { return value.c_str(); }
+        char* begin() { return &value[0]; }
+        boolean reserve(unsigned int size) { value.reserve(size); return true; }
+        char operator[](unsigned int index) const { return value[index]; }
+        long toInt() const { return atol(value.c_str()); }
+
+        // ArduinoJson writes the strings with these
+        unsigned char concat(const char* text) { value += text; return 1; }
+        unsigned char concat(const char* text, unsigned int length) { value.append(text, length); return 1; }
+
+        int indexOf(char c, unsigned int from = 0) const { return position(value.find(c, from)); }
+        int indexOf(const char* text, unsigned int from = 0) const { return position(value.find(text, from)); }
+        String substring(unsigned int from) const { return value.substr(from); }
+        String substring(unsigned int from, unsigned int to) const { return value.substr(from, to - from); }
+        void remove(unsigned int index) { value.erase(index); }
+
+        String& operator+=(const String &text) { value += text.value; return *this; }
+        String& operator+=(const char* text) { value += text; return *this; }
+        String& operator+=(char c) { value += c; return *this; }
+        boolean operator==(const String &text) const { return value == text.value; }
+        boolean operator==(const char* text) const { return value == text; }
+        boolean operator!=(const String &text) const { return value != text.value; }
+        boolean operator!=(const char* text) const { return value != text; }
+
+    private:
+        static int position(size_t found) {
+            return (found == std::string::npos) ? -1 : (int) found;
+        }
+};
+
+// ArduinoJson refers to it (result type of the + operators in the Arduino core)
+class StringSumHelper : public String {
+};
+
+inline String operator+(const String &a, const String &b) { String sum = a; sum += b; return sum; }
+inline String operator+(const String &a, const char* b) { String sum = a; sum += b; return sum; }
+inline String operator+(const char* a, const String &b) { String sum = a; sum += b; return sum; }
+
+#endif
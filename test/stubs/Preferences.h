@@ -0,0 +1,307 @@
+// Host (native) build: in-memory Preferences (NVS) of the ESP32 core. The namespaces are kept across the instances
+// like the flash keeps them across reboots. writes() counts the put calls (not an ESP32 API, for the tests only).
+// The values are kept in maps, the flash usage is simulated by NvsFlash (see below), Preferences::flash() is the model.
+#ifndef PREFERENCES_STUB
+#define PREFERENCES_STUB
+
+#include <Arduino.h>
+#include <map>
+#include <deque>
+#include <vector>
+#include <string>
+
+// RAM model of the NVS partition: pages of 32 byte entries, wear is the number of the page erases.
+// Like NVS: a value is appended into the active page (a string in one page, a blob in chunks and an index entry),
+// the entries of the previous value are marked erased after it. A full page is left, the next free page is taken.
+// One free page is reserved: when only that is left, the page with the most erased entries is compacted into it
+// (the live entries are copied) and erased, it becomes the reserved free page.
+class NvsFlash {
+
+    public:
+        static const int PAGE_COUNT = 5;        // default nvs partition of the ESP32 core (0x5000)
+        static const int ENTRY_COUNT = 126;     // 4096 byte page: 32 byte header, 32 byte entry state table
+        static const int ENTRY_SIZE = 32;
+
+        // Counters since the last format()
+        uint32_t writtenEntries = 0;            // entries of the put calls
+        uint32_t movedEntries = 0;              // entries copied by the compaction
+        uint32_t erases = 0;
+
+    private:
+        struct Entry {
+            int owner;                          // key id, -1 if erased
+            uint32_t version;
+        };
+
+        struct Page {
+            std::vector<Entry> entries;         // written entries, the rest of the page is free
+            uint32_t erases = 0;
+        };
+
+        std::vector<Page> pages;
+        std::deque<int> freePages;
+        int active = 0;
+        std::map<std::string, int> ids;
+        std::vector<uint32_t> versions;
+
+    public:
+        NvsFlash() {
+            format();
+        }
+
+        void format() {
+            pages.assign(PAGE_COUNT, Page());
+            freePages.clear();
+            for (int i = 1; i < PAGE_COUNT; i++) {
+                freePages.push_back(i);
+            }
+            active = 0;
+            ids.clear();
+            versions.clear();
+            writtenEntries = 0;
+            movedEntries = 0;
+            erases = 0;
+        }
+
+        // Integers and the namespace entries: one entry
+        boolean putPrimitive(const std::string &key) {
+            return put(key, 1);
+        }
+
+        // String: header entry and the data with the terminating zero
+        boolean putString(const std::string &key, size_t length) {
+            return put(key, 1 + dataEntries(length + 1));
+        }
+
+        // Blob: chunks (header entry and data) in the free space of the pages, then the index entry
+        boolean putBlob(const std::string &key, size_t length) {
+            int id = keyId(key);
+            uint32_t version = ++versions[id];
+            int remaining = dataEntries(length);
+            while (remaining > 0) {
+                int room;
+                while ((room = ENTRY_COUNT - (int) pages[active].entries.size() - 1) < 1) {
+                    if (!nextPage()) {
+                        return false;
+                    }
+                }
+                int chunk = (remaining < room) ? remaining : room;
+                append(id, version, 1 + chunk);
+                remaining -= chunk;
+            }
+            if (!append(id, version, 1)) {
+                return false;
+            }
+            erase(id, version);
+            return true;
+        }
+
+        void remove(const std::string &key) {
+            auto found = ids.find(key);
+            if (found != ids.end()) {
+                erase(found -> second, versions[found -> second] + 1);
+            }
+        }
+
+        // Entries which are not live (free or erased), like nvs_get_stats()
+        size_t freeEntries() const {
+            size_t live = 0;
+            for (const Page &page : pages) {
+                for (const Entry &entry : page.entries) {
+                    live += (entry.owner >= 0) ? 1 : 0;
+                }
+            }
+            return PAGE_COUNT * ENTRY_COUNT - live;
+        }
+
+        uint32_t pageErases(int page) const {
+            return pages[page].erases;
+        }
+
+    private:
+        static int dataEntries(size_t length) {
+            return (length + ENTRY_SIZE - 1) / ENTRY_SIZE;
+        }
+
+        int keyId(const std::string &key) {
+            auto found = ids.find(key);
+            if (found != ids.end()) {
+                return found -> second;
+            }
+            versions.push_back(0);
+            return ids[key] = versions.size() - 1;
+        }
+
+        boolean put(const std::string &key, int count) {
+            int id = keyId(key);
+            uint32_t version = ++versions[id];
+            if (!append(id, version, count)) {
+                return false;
+            }
+            erase(id, version);
+            return true;
+        }
+
+        // The entries of a value are in one page
+        boolean append(int id, uint32_t version, int count) {
+            while ((int) pages[active].entries.size() + count > ENTRY_COUNT) {
+                if (!nextPage()) {
+                    return false;
+                }
+            }
+            for (int i = 0; i < count; i++) {
+                pages[active].entries.push_back(Entry{id, version});
+            }
+            writtenEntries += count;
+            return true;
+        }
+
+        // Entries of the older versions
+        void erase(int id, uint32_t version) {
+            for (Page &page : pages) {
+                for (Entry &entry : page.entries) {
+                    if (entry.owner == id && entry.version < version) {
+                        entry.owner = -1;
+                    }
+                }
+            }
+        }
+
+        boolean nextPage() {
+            if (freePages.size() >= 2) {
+                active = freePages.front();
+                freePages.pop_front();
+                return true;
+            }
+            int victim = -1;
+            size_t mostErased = 0;
+            for (int i = 0; i < PAGE_COUNT; i++) {
+                size_t erased = 0;
+                for (const Entry &entry : pages[i].entries) {
+                    erased += (entry.owner < 0) ? 1 : 0;
+                }
+                if (erased > mostErased) {
+                    mostErased = erased;
+                    victim = i;
+                }
+            }
+            if (victim < 0) {
+                // Full of live values
+                return false;
+            }
+            active = freePages.front();
+            freePages.pop_front();
+            for (const Entry &entry : pages[victim].entries) {
+                if (entry.owner >= 0) {
+                    pages[active].entries.push_back(entry);
+                    movedEntries++;
+                }
+            }
+            pages[victim].entries.clear();
+            pages[victim].erases++;
+            erases++;
+            freePages.push_back(victim);
+            return true;
+        }
+};
+
+class Preferences {
+
+    std::map<std::string, std::string> *values = NULL;
+    std::string name;
+
+    public:
+        boolean begin(const char* name, boolean readOnly = false) {
+            if (storage().count(name) == 0) {
+                // The namespace entry
+                flash().putPrimitive(std::string("\x01") + name);
+            }
+            values = &storage()[name];
+            this -> name = name;
+            return true;
+        }
+
+        void end() {
+            values = NULL;
+        }
+
+        boolean clear() {
+            for (auto &value : *values) {
+                flash().remove(flashKey(value.first.c_str()));
+            }
+            values -> clear();
+            return true;
+        }
+
+        boolean remove(const char* key) {
+            flash().remove(flashKey(key));
+            return values -> erase(key) > 0;
+        }
+
+        boolean isKey(const char* key) {
+            return values -> count(key) > 0;
+        }
+
+        size_t putString(const char* key, const String &value) {
+            writes()++;
+            if (!flash().putString(flashKey(key), value.length())) {
+                return 0;
+            }
+            (*values)[key] = std::string(value.c_str(), value.length());
+            return value.length();
+        }
+
+        String getString(const char* key, const String &defaultValue = String()) {
+            auto found = values -> find(key);
+            return (found == values -> end()) ? defaultValue : String(found -> second);
+        }
+
+        size_t putBytes(const char* key, const void* data, size_t length) {
+            writes()++;
+            if (!flash().putBlob(flashKey(key), length)) {
+                return 0;
+            }
+            (*values)[key] = std::string((const char*) data, length);
+            return length;
+        }
+
+        size_t getBytesLength(const char* key) {
+            auto found = values -> find(key);
+            return (found == values -> end()) ? 0 : found -> second.size();
+        }
+
+        size_t getBytes(const char* key, void* buffer, size_t length) {
+            auto found = values -> find(key);
+            if (found == values -> end() || found -> second.size() > length) {
+                return 0;
+            }
+            memcpy(buffer, found -> second.data(), found -> second.size());
+            return found -> second.size();
+        }
+
+        size_t freeEntries() {
+            return flash().freeEntries();
+        }
+
+        static uint32_t& writes() {
+            static uint32_t count = 0;
+            return count;
+        }
+
+        static NvsFlash& flash() {
+            static NvsFlash partition;
+            return partition;
+        }
+
+    private:
+        std::string flashKey(const char* key) {
+            return name + '\0' + key;
+        }
+
+        static std::map<std::string, std::map<std::string, std::string>>& storage() {
+            static std::map<std::string, std::map<std::string, std::string>> namespaces;
+            return namespaces;
+        }
+};
+
+#endif
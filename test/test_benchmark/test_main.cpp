@@ -0,0 +1,528 @@
+// Host benchmarks of the presence hot paths: pio test -e native -f test_benchmark -v
+// The numbers are host numbers, they show the scaling (and the ratio to the earlier code), not the ESP32 speed.
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include <chrono>
+#include "devicetable.cpp"
+#include "timerwheel.cpp"
+#include "replay.h"
+#include "adparser.cpp"
+#include "rpa.cpp"
+#include "mqttqueue.cpp"
+#include "topicbuffer.cpp"
+#include "config.cpp"
+#include <ArduinoJson.h>
+#include <new>
+
+// Keeps the compiler from dropping the measured work
+static volatile uint64_t sink = 0;
+
+// Heap allocations of the measured code
+static uint64_t allocations = 0;
+
+void* operator new(size_t size) {
+    allocations++;
+    void* memory = malloc(size);
+    if (memory == NULL) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t size) noexcept {
+    free(memory);
+}
+
+static double nanoseconds(std::chrono::steady_clock::time_point start, uint32_t operations) {
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / operations;
+}
+
+static void report(const char* name, int devices, double ns, double baseline) {
+    char line[160];
+    if (baseline > 0) {
+        snprintf(line, sizeof(line), "%-28s %6d devices: %8.1f ns/op (earlier code %9.1f ns/op)", name, devices, ns, baseline);
+    } else {
+        snprintf(line, sizeof(line), "%-28s %6d devices: %8.1f ns/op", name, devices, ns);
+    }
+    TEST_MESSAGE(line);
+}
+
+// Spread like the real addresses (vendor prefix + random part)
+static uint64_t testMac(uint32_t i) {
+    return 0x24A160000000ULL | ((i * 2654435761u) & 0xFFFFFF);
+}
+
+// The device list before the hash table: LinkedList<Device> with String fields, searched by the MAC text
+struct StringDevice {
+    String mac;
+    String name;
+    String rssi;
+};
+
+static double linearLookup(std::vector<StringDevice> &list, const std::vector<String> &macs, uint32_t operations) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        const String &mac = macs[(i * 7919) % macs.size()];     // spread over the whole list
+        for (size_t j = 0; j < list.size(); j++) {
+            StringDevice dev = list[j];         // get(i) copied the device out
+            if (dev.mac == mac) {
+                list[j] = dev;                  // set(i, dev) copied it back
+                sink += j;
+                break;
+            }
+        }
+    }
+    return nanoseconds(start, operations);
+}
+
+void benchmarkDeviceTableLookup() {
+    const int sizes[] = {10, 100, 1000, 10000};
+    for (int size : sizes) {
+        DeviceTable table;
+        std::vector<StringDevice> list;
+        std::vector<uint64_t> keys;
+        std::vector<String> macs;
+        for (int i = 0; i < size; i++) {
+            Device device = {};
+            device.mac = testMac(i);
+            table.insert(device.mac, device);
+            keys.push_back(device.mac);
+            macs.push_back(keyToMac(device.mac));
+            list.push_back(StringDevice{macs.back(), "name", "-70"});
+        }
+
+        const uint32_t operations = 1000000;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < operations; i++) {
+            Device* device = table.find(keys[i % size]);
+            device->rssi = -(int8_t) (i & 0x3F);    // in place update
+            sink += device->mark;
+        }
+        double ns = nanoseconds(start, operations);
+
+        // The linear scan is slow, fewer rounds
+        double baseline = linearLookup(list, macs, (size >= 1000) ? 2000 : 100000);
+        report("DeviceTable find + update", size, ns, baseline);
+        TEST_ASSERT_EQUAL(size, table.size());
+    }
+}
+
+// Device deadline checks in the loop(): timer wheel (lazy rescheduling, see Presence::checkDevice) against the earlier
+// sweep over every device in every loop(). 10 minutes in 10 ms loop() steps, every device is seen in every 1-10 s.
+void benchmarkExpiryChecks() {
+    const int sizes[] = {10, 100, 1000, 10000};
+    const uint32_t timeout = BT_DEVICE_TIMEOUT;
+    const uint32_t step = 10;
+    const uint32_t duration = 10 * 60 * 1000;
+
+    for (int size : sizes) {
+        std::vector<uint32_t> lastSeen(size, 0);
+        std::vector<uint32_t> period(size);
+        for (int i = 0; i < size; i++) {
+            period[i] = 1000 + (i * 7919) % 9000;
+        }
+
+        TimerWheel<BT_TIMER_WHEEL_SLOTS, BT_TIMER_WHEEL_RESOLUTION>* wheel = new TimerWheel<BT_TIMER_WHEEL_SLOTS, BT_TIMER_WHEEL_RESOLUTION>();
+        wheel->start(0);
+        for (int i = 0; i < size; i++) {
+            wheel->schedule(i, timeout);
+        }
+        uint32_t loops = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t now = 0; now < duration; now += step, loops++) {
+            // Advertisements of this step
+            for (int i = (now / step) % 100; i < size; i += 100) {
+                if (now - lastSeen[i] >= period[i]) {
+                    lastSeen[i] = now;
+                }
+            }
+            wheel->advance(now, [&](uint64_t key, uint16_t slot) {
+                if (!timeReached(now, lastSeen[key] + timeout)) {
+                    wheel->schedule(key, lastSeen[key] + timeout);
+                } else {
+                    sink += key;
+                }
+            });
+        }
+        double wheelNs = nanoseconds(start, loops);
+        delete wheel;
+
+        std::fill(lastSeen.begin(), lastSeen.end(), 0);
+        loops = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t now = 0; now < duration; now += step, loops++) {
+            for (int i = (now / step) % 100; i < size; i += 100) {
+                if (now - lastSeen[i] >= period[i]) {
+                    lastSeen[i] = now;
+                }
+            }
+            for (int i = 0; i < size; i++) {
+                if (timeReached(now, lastSeen[i] + timeout)) {
+                    sink += i;
+                }
+            }
+        }
+        double sweepNs = nanoseconds(start, loops);
+        report("Expiry checks per loop()", size, wheelNs, sweepNs);
+    }
+}
+
+// Beacon identity from the raw payload: iBeacon, Eddystone-UID and a phone (flags, name, manufacturer data, no beacon)
+void benchmarkAdParser() {
+    const uint8_t ibeacon[] = {0x02, 0x01, 0x06, 0x1A, 0xFF, 0x4C, 0x00, 0x02, 0x15,
+        0xE2, 0xC5, 0x6D, 0xB5, 0xDF, 0xFB, 0x48, 0xD2, 0xB0, 0x60, 0xD0, 0xF5, 0xA7, 0x10, 0x96, 0xE0, 0x00, 0x01, 0x00, 0x02, 0xC5};
+    const uint8_t eddystone[] = {0x02, 0x01, 0x06, 0x03, 0x03, 0xAA, 0xFE, 0x17, 0x16, 0xAA, 0xFE, 0x00, 0xE7,
+        0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x00, 0x00};
+    const uint8_t phone[] = {0x02, 0x01, 0x1A, 0x0A, 0x09, 'M', 'y', ' ', 'p', 'h', 'o', 'n', 'e', '!',
+        0x0B, 0xFF, 0x4C, 0x00, 0x10, 0x06, 0x1B, 0x1E, 0x5A, 0x3C, 0x8B, 0x18, 0x02, 0x0A, 0x0C};
+    const uint8_t* payloads[] = {ibeacon, eddystone, phone};
+    const uint8_t lengths[] = {sizeof(ibeacon), sizeof(eddystone), sizeof(phone)};
+
+    TEST_ASSERT_NOT_EQUAL(0, beaconIdentity(ibeacon, sizeof(ibeacon)));
+    TEST_ASSERT_NOT_EQUAL(0, beaconIdentity(eddystone, sizeof(eddystone)));
+    TEST_ASSERT_EQUAL(0, beaconIdentity(phone, sizeof(phone)));
+
+    const uint32_t operations = 10000000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        sink += beaconIdentity(payloads[i % 3], lengths[i % 3]);
+    }
+    double ns = nanoseconds(start, operations);
+
+    char line[160];
+    snprintf(line, sizeof(line), "Beacon identity (mixed payloads): %.1f ns/payload, %.1f M payloads/s", ns, 1000.0 / ns);
+    TEST_MESSAGE(line);
+}
+
+// Presence logic throughput with the host replay: one hour of 200 devices (advertising in every 0.1-2 s) from a trace in memory
+void benchmarkReplayThroughput() {
+    const int devices = 200;
+    std::vector<uint8_t> trace(TRACE_HEADER_LENGTH);
+    traceWriteHeader(trace.data());
+    uint32_t lastTimestamp = 0;
+    Advertisement advertisement = {};
+    advertisement.rssi = -70;
+    for (uint32_t now = 0; now < 60 * 60 * 1000; now += 10) {
+        for (int i = 0; i < devices; i++) {
+            uint32_t period = 100 + (i * 7919) % 1900;
+            if ((now + i * 13) % period >= 10) {
+                continue;
+            }
+            advertisement.address = testMac(i);
+            advertisement.timestamp = now;
+            uint8_t record[TRACE_RECORD_MAX_LENGTH];
+            size_t length = traceWriteRecord(record, advertisement, lastTimestamp);
+            trace.insert(trace.end(), record, record + length);
+            lastTimestamp = now;
+        }
+    }
+
+    Replay replay([](const ReplayTransition &transition) {
+        sink += transition.key;
+    });
+    TraceReader reader(trace.data(), trace.size());
+    ReplayStats stats = replay.run(reader, 0, 0);
+
+    char line[160];
+    snprintf(line, sizeof(line), "Replay: %u advertisements, %.1f h of trace in %.3f s: %.2f M advertisements/s, %.0fx real time",
+        stats.advertisements, stats.traceTime / 3600000.0, stats.seconds, stats.advertisements / stats.seconds / 1e6,
+        stats.traceTime / 1000.0 / stats.seconds);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL(devices, replay.getPresence().size());
+}
+
+// Departure detection latency with the replay: fixed timeout against the learned (adaptive) one.
+// Devices advertising in every 0.1 s, 1 s and 10 s (10 of each), 20 % or 40 % of the advertisements are lost, every device
+// leaves after 30 minutes.
+struct DepartureResult {
+    double latency[3] = {0, 0, 0};      // average seconds from the last advertisement to not available, per interval class
+    uint32_t falseDepartures[3] = {0, 0, 0};   // not available while the device was still there
+};
+
+static DepartureResult replayDepartures(uint8_t confidence, uint32_t loss) {
+    const uint32_t intervals[3] = {100, 1000, 10000};
+    const int perClass = 10;
+    const uint32_t leave = 30 * 60 * 1000;
+
+    std::vector<uint8_t> trace(TRACE_HEADER_LENGTH);
+    traceWriteHeader(trace.data());
+    uint32_t lastTimestamp = 0;
+    uint32_t lost = 12345;
+    Advertisement advertisement = {};
+    advertisement.rssi = -70;
+    for (uint32_t now = 0; now < leave; now += 100) {
+        for (int i = 0; i < 3 * perClass; i++) {
+            if ((now + i * 100) % intervals[i / perClass] != 0) {
+                continue;
+            }
+            lost = lost * 1103515245 + 12345;
+            if ((lost >> 16) % 100 < loss) {
+                continue;
+            }
+            advertisement.address = testMac(i);
+            advertisement.timestamp = now;
+            uint8_t record[TRACE_RECORD_MAX_LENGTH];
+            trace.insert(trace.end(), record, record + traceWriteRecord(record, advertisement, lastTimestamp));
+            lastTimestamp = now;
+        }
+    }
+
+    DepartureResult result;
+    Replay replay([&](const ReplayTransition &transition) {
+        if (transition.available) {
+            return;
+        }
+        for (int i = 0; i < 3 * perClass; i++) {
+            if (testMac(i) != transition.key) {
+                continue;
+            }
+            if (transition.time < leave) {
+                result.falseDepartures[i / perClass]++;
+            } else {
+                result.latency[i / perClass] += (transition.time - transition.lastSeen) / 1000.0 / perClass;
+            }
+        }
+    });
+    PresenceConfig config;
+    config.confidence = confidence;
+    replay.configure(config);
+    TraceReader reader(trace.data(), trace.size());
+    replay.run(reader, 0, config.timeoutCeiling + BT_DEVICE_TIMEOUT);
+    return result;
+}
+
+void benchmarkDepartureLatency() {
+    const uint32_t losses[2] = {20, 40};
+    const char* names[3] = {"0.1 s", "1 s", "10 s"};
+    for (int j = 0; j < 2; j++) {
+        DepartureResult fixed = replayDepartures(0, losses[j]);
+        DepartureResult adaptive = replayDepartures(95, losses[j]);
+        for (int i = 0; i < 3; i++) {
+            char line[160];
+            snprintf(line, sizeof(line), "Departure latency, %5s interval, %u %% loss: adaptive %6.1f s, fixed timeout %6.1f s, false departures %u / %u",
+                names[i], losses[j], adaptive.latency[i], fixed.latency[i], adaptive.falseDepartures[i], fixed.falseDepartures[i]);
+            TEST_MESSAGE(line);
+            // The learned timeout is not worse than the fixed one for any advertising interval
+            TEST_ASSERT_LESS_OR_EQUAL(fixed.falseDepartures[i], adaptive.falseDepartures[i]);
+            TEST_ASSERT_LESS_OR_EQUAL(fixed.latency[i] + 1, adaptive.latency[i]);
+        }
+
+        // Fast beacons leave in seconds (floor + wheel resolution), not minutes
+        TEST_ASSERT_LESS_THAN(BT_ADAPTIVE_TIMEOUT_FLOOR / 1000 + 2, adaptive.latency[0]);
+        TEST_ASSERT_LESS_THAN(30, adaptive.latency[1]);
+        TEST_ASSERT_GREATER_THAN(BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT / 1000 - 1, fixed.latency[0]);
+    }
+}
+
+// Private address resolution of the advertisements: 200 random addresses in range, 8 IRKs, the cache against
+// checking every advertisement with every key (one AES operation each). The earlier 32 entry FIFO cache missed on
+// every advertisement with this many devices, like the uncached check.
+void benchmarkRpaResolution() {
+    const int devices = 200;
+    std::vector<IdentityResolvingKey> keys(8);
+    for (size_t i = 0; i < keys.size(); i++) {
+        keys[i].key = testMac(i);
+        for (int j = 0; j < 16; j++) {
+            keys[i].irk[j] = (uint8_t) (i * 31 + j * 7);
+        }
+    }
+    std::vector<uint64_t> addresses;
+    for (int i = 0; i < devices; i++) {
+        addresses.push_back((0x400000ULL | ((i * 2654435761u) & 0x3FFFFF)) << 24 | ((i * 40503u) & 0xFFFFFF));
+    }
+
+    RpaResolver resolver;
+    resolver.setCacheSize(devices);
+    resolver.setKeys(keys);
+    const uint32_t operations = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        sink += resolver.resolve(addresses[(i * 7919) % devices], true);
+    }
+    double ns = nanoseconds(start, operations);
+
+    const uint32_t uncachedOperations = 20000;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < uncachedOperations; i++) {
+        uint64_t address = addresses[(i * 7919) % devices];
+        for (size_t k = 0; k < keys.size(); k++) {
+            if (RpaResolver::ah(keys[k].irk, (address >> 24) & 0xFFFFFF) == (address & 0xFFFFFF)) {
+                sink += k;
+                break;
+            }
+        }
+    }
+    double baseline = nanoseconds(start, uncachedOperations);
+    report("RPA resolve (8 IRKs)", devices, ns, baseline);
+    TEST_ASSERT_EQUAL(devices, resolver.getMisses());
+}
+
+// The write calls of the MQTT client, into a buffer
+struct FakeMqttClient {
+    char buffer[256];
+    size_t length = 0;
+
+    void beginMessage(const char* topic, size_t size, boolean retain) {
+        length = strlen(topic);
+        memcpy(buffer, topic, length);
+    }
+
+    void print(const String &payload) {
+        memcpy(buffer + length, payload.c_str(), payload.length());
+        length += payload.length();
+    }
+
+    int endMessage() {
+        sink += length;
+        return 1;
+    }
+};
+
+// Signal::fire() and the MethodSlot take the message by value
+static void __attribute__((noinline)) firedMessage(MQTTMessage message, MqttQueue &queue) {
+    queue.push(message);
+}
+
+static void __attribute__((noinline)) firedState(StateMessage state, TopicBuffer &topics, const String payloads[2], FakeMqttClient &client) {
+    const char* topic = topics.device(state.key);
+    client.beginMessage(topic, payloads[state.available].length(), true);
+    client.print(payloads[state.available]);
+    client.endMessage();
+}
+
+// Device state publish: the earlier code (MQTT text of the device key, String topic and payload copied through the
+// Signal into the queue, topic concatenated at the write) against StateMessage + TopicBuffer.
+// The host String keeps up to 15 characters without allocation (std::string), the String of the ESP32 allocates
+// for every copy, so the earlier code allocates more on the device than what is counted here.
+void benchmarkStatePublish() {
+    const int devices = 200;
+    const String baseTopic = "home/blecker";
+    const String payloads[2] = {"not_present", "present"};
+    FakeMqttClient client;
+    const uint32_t operations = 1000000;
+
+    MqttQueue queue;
+    allocations = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        uint64_t key = testMac(i % devices);
+        boolean available = i & 1;
+        firedMessage(MQTTMessage{keyToMac(key), payloads[available], true}, queue);
+        MQTTMessage message;
+        queue.pop(message);
+        String topic = baseTopic + "/" + message.topic;
+        client.beginMessage(topic.c_str(), message.payload.length(), message.retain);
+        client.print(message.payload);
+        client.endMessage();
+    }
+    double earlierNs = nanoseconds(start, operations);
+    double earlierAllocations = (double) allocations / operations;
+
+    TopicBuffer topics;
+    topics.setBase(baseTopic);
+    allocations = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        firedState(StateMessage{testMac(i % devices), (boolean) (i & 1), LATENCY_NONE, 0, 0}, topics, payloads, client);
+    }
+    double ns = nanoseconds(start, operations);
+    double stateAllocations = (double) allocations / operations;
+
+    char line[200];
+    snprintf(line, sizeof(line), "State publish: %.1f ns, %.2f allocations (earlier code %.1f ns, %.2f allocations), %.1f M publishes/s",
+        ns, stateAllocations, earlierNs, earlierAllocations, 1000.0 / ns);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL(0, allocations);
+    TEST_ASSERT_EQUAL_STRING_LEN("home/blecker/", client.buffer, 13);
+}
+
+// Every key of a configured board, in the order of the web form (the presence strings and the webhook are not in front)
+static const char* const settingKeys[] = {"name", DB_WIFI_NAME, DB_WIFI_PASSWORD, DB_MQTT_SERVER, DB_MQTT_PORT, DB_MQTT_USER,
+    DB_MQTT_PW, DB_MQTT_TOPIC_PREFIX, DB_MQTT_SEND_RATE, DB_MQTT_KEEPALIVE, DB_VERSION, DB_DETAILED_REPORT,
+    DB_HA_AUTODISCOVERY, DB_HA_AUTODISCOVERY_PREFIX, DB_REBOOT_TIMEOUT, DB_DEVICE_STATUS_ON, DB_DEVICE_STATUS_OFF,
+    DB_DEVICE_STATUS_RETAIN, DB_DEVICE_ID, DB_TRACE_HOST, DB_TRACE_PORT, DB_RSSI_SMOOTHING, DB_RSSI_ENTER, DB_RSSI_EXIT,
+    DB_MIN_DWELL, DB_MAX_DEVICES, DB_BEACON_IDENTITY, DB_IRKS, DB_TIMEOUT_CONFIDENCE, DB_TIMEOUT_FLOOR, DB_TIMEOUT_CEILING,
+    DB_FUSION_MODE, DB_FUSION_TOPIC, DB_ROOM, DB_BATCH_MODE, DB_BATCH_TOPIC, DB_PRECENCE, DB_NO_PRECENCE, DB_WEBHOOK};
+
+// Earlier Database::getValueAsString(): key search in the settings document and a String copy of the value
+static String __attribute__((noinline)) documentLookup(JsonDocument &document, const String &name) {
+    if (document.containsKey(name)) {
+        return document[name.c_str()].as<String>();
+    }
+    return (String) "";
+}
+
+static const char* __attribute__((noinline)) configLookup(const Config &config, boolean available) {
+    return available ? config.present : config.notPresent;
+}
+
+// Settings read per state change (presence payload and webhook): the earlier string keyed lookups against the
+// typed Config snapshot (see Database::rebuildConfig())
+void benchmarkConfigLookup() {
+    DynamicJsonDocument document(DB_JSON_SIZE);
+    for (size_t i = 0; i < sizeof(settingKeys) / sizeof(settingKeys[0]); i++) {
+        document[settingKeys[i]] = String("1");
+    }
+    document[DB_PRECENCE] = String("home");
+    document[DB_NO_PRECENCE] = String("not_home");
+    document[DB_WEBHOOK] = String("http://192.168.1.10:8123/api/webhook/{mac}-{presence}");
+    TEST_ASSERT_FALSE(document.overflowed());
+
+    const String presentKey = DB_PRECENCE;
+    const String notPresentKey = DB_NO_PRECENCE;
+    const String webhookKey = DB_WEBHOOK;
+    const uint32_t operations = 1000000;
+    allocations = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        String presence = documentLookup(document, (i & 1) ? presentKey : notPresentKey);
+        String webhook = documentLookup(document, webhookKey);
+        sink += presence.length() + webhook.length();
+    }
+    double earlierNs = nanoseconds(start, operations);
+    double earlierAllocations = (double) allocations / operations;
+
+    Config config;
+    Config::copy(config.present, sizeof(config.present), documentLookup(document, presentKey));
+    Config::copy(config.notPresent, sizeof(config.notPresent), documentLookup(document, notPresentKey));
+    Config::copy(config.webhook, sizeof(config.webhook), documentLookup(document, webhookKey));
+    allocations = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < operations; i++) {
+        sink += configLookup(config, i & 1)[0] + config.webhook[0];
+    }
+    double ns = nanoseconds(start, operations);
+    double configAllocations = (double) allocations / operations;
+
+    char line[200];
+    snprintf(line, sizeof(line), "Config lookup (%u keys): %.1f ns, %.2f allocations (earlier code %.1f ns, %.2f allocations) per state change",
+        (unsigned) document.size(), ns, configAllocations, earlierNs, earlierAllocations);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_EQUAL(0, allocations);
+    TEST_ASSERT_EQUAL_STRING("home", configLookup(config, true));
+    TEST_ASSERT_EQUAL_STRING("not_home", configLookup(config, false));
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(benchmarkDeviceTableLookup);
+    RUN_TEST(benchmarkExpiryChecks);
+    RUN_TEST(benchmarkReplayThroughput);
+    RUN_TEST(benchmarkAdParser);
+    RUN_TEST(benchmarkRpaResolution);
+    RUN_TEST(benchmarkDepartureLatency);
+    RUN_TEST(benchmarkStatePublish);
+    RUN_TEST(benchmarkConfigLookup);
+    return UNITY_END();
+}
@@ -0,0 +1,191 @@
+// Flash wear of the settings store: years of realistic changes replayed on the NVS flash model of the Preferences stub
+// (Preferences::flash()), the page erases are compared to the EEPROM version (full EEPROM_SIZE blob, written twice per save)
+#include <Arduino.h>
+#include <unity.h>
+#include "nvsstore.cpp"
+
+#define WEAR_YEARS 10
+#define WEAR_OTA_PER_YEAR 12 // version write after every update
+#define WEAR_EDITS_PER_YEAR 52 // a setting and the observed device list are changed every week (web interface or MQTT)
+#define WEAR_OBSERVED_DEVICES 30
+
+struct Wear {
+    uint32_t saves = 0;
+    uint32_t erases = 0;
+    uint32_t maxPageErases = 0;
+    uint32_t minPageErases = 0;
+    uint32_t writtenEntries = 0;
+    uint32_t movedEntries = 0;
+};
+
+static void readWear(uint32_t saves, Wear &wear) {
+    NvsFlash &flash = Preferences::flash();
+    wear.saves = saves;
+    wear.erases = flash.erases;
+    wear.minPageErases = flash.pageErases(0);
+    for (int i = 0; i < NvsFlash::PAGE_COUNT; i++) {
+        wear.maxPageErases = std::max(wear.maxPageErases, flash.pageErases(i));
+        wear.minPageErases = std::min(wear.minPageErases, flash.pageErases(i));
+    }
+    wear.writtenEntries = flash.writtenEntries;
+    wear.movedEntries = flash.movedEntries;
+}
+
+static void fillSettings(JsonDocument &document) {
+    document.clear();
+    document["name"] = BOARD_NAME;
+    document[DB_WIFI_NAME] = "home-network";
+    document[DB_WIFI_PASSWORD] = "correct horse battery";
+    document[DB_MQTT_SERVER] = "192.168.1.10";
+    document[DB_MQTT_PORT] = "1883";
+    document[DB_MQTT_USER] = "blecker";
+    document[DB_MQTT_PW] = "secret";
+    document[DB_MQTT_TOPIC_PREFIX] = "/blecker";
+    document[DB_PRECENCE] = DEFAULT_PRESENT;
+    document[DB_NO_PRECENCE] = DEFAULT_NOT_PRESENT;
+    document[DB_VERSION] = "1.10";
+    document[DB_DETAILED_REPORT] = "true";
+    document[DB_HA_AUTODISCOVERY] = "true";
+    document[DB_HA_AUTODISCOVERY_PREFIX] = "homeassistant";
+    document[DB_REBOOT_TIMEOUT] = "0";
+    document[DB_WEBHOOK] = "http://192.168.1.10:8123/api/webhook/blecker";
+    document[DB_DEVICE_STATUS_ON] = MQTT_STATUS_ON_DEFAULT_VALUE;
+    document[DB_DEVICE_STATUS_OFF] = MQTT_STATUS_OFF_DEFAULT_VALUE;
+    document[DB_TIMEOUT_CONFIDENCE] = "95";
+    document[DB_ROOM] = "livingroom";
+}
+
+// Packed observed device list: 5 byte header, 6 bytes per MAC address
+static std::vector<uint8_t> observedList(int devices) {
+    return std::vector<uint8_t>(5 + 6 * devices, (uint8_t) devices);
+}
+
+// The settings as the database has them after a reboot, a value is changed in them
+static void reload(NvsStore &store, JsonDocument &document) {
+    document.clear();
+    store.readAll(document);
+}
+
+// Every change is one save of the changed value
+static void replayStore(Wear &wear) {
+    Preferences::flash().format();
+    NvsStore store;
+    store.begin();
+    StaticJsonDocument<2048> document;
+    String rejected;
+    fillSettings(document);
+    store.write(document, rejected);
+    std::vector<uint8_t> list = observedList(WEAR_OBSERVED_DEVICES);
+    store.writeBlob(STORE_DEVICES_KEY, list.data(), list.size());
+
+    const char* edited[] = {DB_WEBHOOK, DB_PRECENCE, DB_ROOM, DB_TIMEOUT_CONFIDENCE, DB_MQTT_SERVER};
+    uint32_t saves = 0;
+    for (int year = 0; year < WEAR_YEARS; year++) {
+        for (int week = 0; week < WEAR_EDITS_PER_YEAR; week++) {
+            int otaWeeks = WEAR_EDITS_PER_YEAR / WEAR_OTA_PER_YEAR;
+            if (week % otaWeeks == 0 && week / otaWeeks < WEAR_OTA_PER_YEAR) {
+                String version = String("1.") + String(11 + year * WEAR_OTA_PER_YEAR + week / otaWeeks);
+                reload(store, document);
+                document[DB_VERSION] = version;
+                TEST_ASSERT_EQUAL(1, store.write(document, rejected));
+                saves++;
+            }
+            const char* key = edited[week % 5];
+            reload(store, document);
+            String value = document[key].as<String>().substring(0, 8) + String(week);
+            document[key] = value;
+            TEST_ASSERT_EQUAL(1, store.write(document, rejected));
+            saves++;
+
+            list = observedList(WEAR_OBSERVED_DEVICES + (week % 2));
+            store.writeBlob(STORE_DEVICES_KEY, list.data(), list.size());
+            saves++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, rejected.length());
+    readWear(saves, wear);
+}
+
+// The EEPROM version: reset() writes and commits the zeroed area, then the JSON data is written and committed
+static void replayEeprom(uint32_t saves, Wear &wear) {
+    Preferences::flash().format();
+    Preferences eeprom;
+    eeprom.begin("eeprom", false);
+    std::vector<uint8_t> area(EEPROM_SIZE, 0);
+    for (uint32_t i = 0; i < saves; i++) {
+        eeprom.putBytes("eeprom", area.data(), area.size());
+        eeprom.putBytes("eeprom", area.data(), area.size());
+    }
+    readWear(saves, wear);
+}
+
+static void report(const char* name, const Wear &wear) {
+    char line[200];
+    snprintf(line, sizeof(line), "%-12s %u saves in %d years: %u page erases (%.1f / year), per page %u..%u, "
+        "entries written %u, moved by the compaction %u",
+        name, wear.saves, WEAR_YEARS, wear.erases, (float) wear.erases / WEAR_YEARS, wear.minPageErases, wear.maxPageErases,
+        wear.writtenEntries, wear.movedEntries);
+    TEST_MESSAGE(line);
+}
+
+void testYearsOfChanges() {
+    Wear store;
+    Wear eeprom;
+    replayStore(store);
+    replayEeprom(store.saves, eeprom);
+    report("NVS store", store);
+    report("EEPROM", eeprom);
+
+    TEST_ASSERT_EQUAL_UINT32(WEAR_YEARS * (WEAR_OTA_PER_YEAR + 2 * WEAR_EDITS_PER_YEAR), store.saves);
+    // Far from the 100k erase cycles of the flash. The page of the values which are never changed is not erased at all.
+    TEST_ASSERT_LESS_THAN(100, store.maxPageErases);
+    // An order of magnitude less than the whole area rewrites
+    TEST_ASSERT_LESS_THAN(eeprom.erases / 10, store.erases);
+}
+
+// write_amplification on /stats counts the written entries, the model adds the compaction copies
+void testMeasuredAmplification() {
+    Preferences::flash().format();
+    NvsStore store;
+    store.begin();
+    StaticJsonDocument<2048> document;
+    String rejected;
+    fillSettings(document);
+    store.write(document, rejected);
+    uint32_t entries = Preferences::flash().writtenEntries;
+    for (int i = 0; i < 1000; i++) {
+        document[DB_VERSION] = String(i);
+        store.write(document, rejected);
+        std::vector<uint8_t> list = observedList(WEAR_OBSERVED_DEVICES + (i % 2));
+        store.writeBlob(STORE_DEVICES_KEY, list.data(), list.size());
+    }
+
+    StaticJsonDocument<512> stats;
+    store.fillStats(stats.to<JsonObject>());
+    NvsFlash &flash = Preferences::flash();
+    // A blob which does not fit the end of a page is split, the extra chunk header is not in the estimate
+    uint32_t flashBytes = stats["flash_bytes"].as<int>();
+    TEST_ASSERT_GREATER_THAN(entries, flash.writtenEntries);
+    TEST_ASSERT_LESS_OR_EQUAL(flash.writtenEntries * NvsFlash::ENTRY_SIZE, flashBytes);
+    TEST_ASSERT_LESS_THAN(flashBytes * 1.05f, flash.writtenEntries * NvsFlash::ENTRY_SIZE);
+
+    float estimated = stats["write_amplification"].as<float>();
+    float measured = (float) (flash.writtenEntries + flash.movedEntries) * NvsFlash::ENTRY_SIZE / stats["changed_bytes"].as<int>();
+    char line[160];
+    snprintf(line, sizeof(line), "Write amplification: %.2f on /stats, %.2f with the compaction copies", estimated, measured);
+    TEST_MESSAGE(line);
+    TEST_ASSERT_LESS_THAN(estimated * 1.5f, measured);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testYearsOfChanges);
+    RUN_TEST(testMeasuredAmplification);
+    return UNITY_END();
+}
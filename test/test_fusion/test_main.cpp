@@ -0,0 +1,182 @@
+// Room level presence: simulated nodes (one Presence per room) publish their RSSI summaries to the room fusion
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "presence.cpp"
+#include "roomfusion.cpp"
+
+struct RoomChange {
+    uint32_t time;
+    uint64_t key;
+    String room;        // empty: not present
+};
+
+struct RecordingListener : public RoomListener {
+    std::vector<RoomChange> changes;
+    uint32_t now = 0;
+
+    void roomChanged(uint64_t key, const char* room) override {
+        changes.push_back(RoomChange{now, key, (room == NULL) ? "" : room});
+    }
+};
+
+// A blecker node: presence logic and the RSSI summary, the same format as BlueTooth::publishRssiSummary()
+struct Node : public PresenceListener {
+    const char* room;
+    Presence presence;
+
+    Node(const char* room, uint32_t now) : room(room) {
+        presence.setup(*this, now);
+    }
+
+    void presenceChanged(const Device &device) override {
+    }
+
+    String summary() {
+        String payload;
+        for (int i = 0; i < presence.size(); i++) {
+            Device &dev = presence.get(i);
+            if (!dev.available) {
+                continue;
+            }
+            char mac[KEY_STRING_LENGTH + 1];
+            formatKey(dev.mac, mac);
+            char entry[KEY_STRING_LENGTH + 8];
+            snprintf(entry, sizeof(entry), (payload.length() > 0) ? ",%s:%d" : "%s:%d", mac, dev.rssi);
+            payload += entry;
+        }
+        return payload;
+    }
+};
+
+static void publish(RoomFusion &fusion, Node &node, uint32_t now) {
+    String payload = node.summary();
+    if (payload.length() > 0) {
+        fusion.summaryArrived(node.room, payload.begin(), now);
+    }
+}
+
+static Advertisement makeAdvertisement(uint64_t mac, uint32_t timestamp, int rssi) {
+    Advertisement advertisement = {};
+    advertisement.mac = mac;
+    advertisement.timestamp = timestamp;
+    advertisement.rssi = rssi;
+    return advertisement;
+}
+
+static const uint64_t PHONE = 0x317234b9d2d0ULL;
+static const uint64_t TAG = 0x15172f81acccULL;
+
+// A phone stays in the kitchen for 10 minutes, walks to the living room in a minute, stays there for 10 minutes and leaves.
+// A tag stays in the bedroom. Every node hears every device, with noise.
+void testWalkBetweenRooms() {
+    const uint32_t walk = 10 * 60 * 1000;
+    const uint32_t leave = walk + 11 * 60 * 1000;
+    const uint32_t end = leave + 5 * 60 * 1000;
+
+    Node kitchen("kitchen", 0);
+    Node living("living", 0);
+    Node bedroom("bedroom", 0);
+    Node* nodes[] = {&kitchen, &living, &bedroom};
+    RoomFusion fusion;
+    RecordingListener listener;
+    fusion.setup(listener);
+
+    uint32_t noise = 1;
+    for (uint32_t now = 0; now < end; now += 100) {
+        listener.now = now;
+        // Position of the phone: 0 kitchen .. 1 living room
+        float position = (now < walk) ? 0 : (now < walk + 60000) ? (now - walk) / 60000.0f : 1;
+        int phoneRssi[3] = {(int) (-60 - 20 * position), (int) (-80 + 20 * position), -90};
+        int tagRssi[3] = {-88, -85, -55};
+
+        for (int n = 0; n < 3; n++) {
+            noise = noise * 1103515245 + 12345;
+            int jitter = (int) ((noise >> 16) % 5) - 2;
+            if (now < leave && (now + n * 300) % 1000 == 0) {
+                nodes[n]->presence.advertisement(makeAdvertisement(PHONE, now, phoneRssi[n] + jitter));
+            }
+            if ((now + n * 700) % 3000 == 0) {
+                nodes[n]->presence.advertisement(makeAdvertisement(TAG, now, tagRssi[n] + jitter));
+            }
+            nodes[n]->presence.loop(now);
+        }
+
+        // The fusing node starts later, the nodes have seen every device already
+        if (now >= 10000 && now % FUSION_PUBLISH_INTERVAL == 0) {
+            for (int n = 0; n < 3; n++) {
+                publish(fusion, *nodes[n], now);
+            }
+        }
+        if (now % FUSION_EVALUATE_INTERVAL == 0) {
+            fusion.loop(now);
+        }
+    }
+
+    std::vector<RoomChange> phone;
+    std::vector<RoomChange> tag;
+    for (size_t i = 0; i < listener.changes.size(); i++) {
+        (listener.changes[i].key == PHONE ? phone : tag).push_back(listener.changes[i]);
+    }
+
+    // Kitchen -> living room once (no flapping within the hysteresis) -> not present
+    TEST_ASSERT_EQUAL(3, phone.size());
+    TEST_ASSERT_EQUAL_STRING("kitchen", phone[0].room.c_str());
+    TEST_ASSERT_EQUAL_STRING("living", phone[1].room.c_str());
+    TEST_ASSERT_GREATER_THAN(walk, phone[1].time);
+    TEST_ASSERT_LESS_THAN(walk + 60000, phone[1].time);
+    TEST_ASSERT_EQUAL_STRING("", phone[2].room.c_str());
+    // Node timeout, then the reading goes stale
+    TEST_ASSERT_LESS_OR_EQUAL(leave + BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT + FUSION_STALE_TIMEOUT + 2 * FUSION_PUBLISH_INTERVAL, phone[2].time);
+
+    // The first summaries of a round arrive one by one: the strongest room wins within the first round, then it stays
+    TEST_ASSERT_EQUAL_STRING("bedroom", tag.back().room.c_str());
+    TEST_ASSERT_EQUAL_UINT32(10000, tag.back().time);
+    TEST_ASSERT_EQUAL(1, fusion.size());
+}
+
+void testHysteresisAndStaleRooms() {
+    RoomFusion fusion;
+    RecordingListener listener;
+    fusion.setup(listener);
+
+    char a[] = "317234b9d2d0:-70";
+    TEST_ASSERT_TRUE(fusion.summaryArrived("kitchen", a, 0));
+    char b[] = "317234b9d2d0:-67";
+    TEST_ASSERT_TRUE(fusion.summaryArrived("living", b, 1000));
+    // Stronger, but within the hysteresis
+    TEST_ASSERT_EQUAL(1, listener.changes.size());
+    char c[] = "317234b9d2d0:-64";
+    TEST_ASSERT_FALSE(fusion.summaryArrived("living", c, 2000));
+    TEST_ASSERT_EQUAL(2, listener.changes.size());
+    TEST_ASSERT_EQUAL_STRING("living", listener.changes[1].room.c_str());
+
+    // Broken entries are skipped
+    char d[] = "nonsense,317234b9d2d0,:-50";
+    fusion.summaryArrived("kitchen", d, 3000);
+    TEST_ASSERT_EQUAL(2, listener.changes.size());
+
+    // The living room reading goes stale: back to the kitchen, if it is still reported
+    char e[] = "317234b9d2d0:-75";
+    fusion.summaryArrived("kitchen", e, 2000 + FUSION_STALE_TIMEOUT + 1);
+    TEST_ASSERT_EQUAL(3, listener.changes.size());
+    TEST_ASSERT_EQUAL_STRING("kitchen", listener.changes[2].room.c_str());
+
+    fusion.loop(2000 + 2 * FUSION_STALE_TIMEOUT + 2);
+    TEST_ASSERT_EQUAL(4, listener.changes.size());
+    TEST_ASSERT_EQUAL_STRING("", listener.changes[3].room.c_str());
+    TEST_ASSERT_EQUAL(0, fusion.size());
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testWalkBetweenRooms);
+    RUN_TEST(testHysteresisAndStaleRooms);
+    return UNITY_END();
+}
@@ -0,0 +1,112 @@
+// Outbound MQTT queue: coalescing of the device states only, full queue, requeue after a failed send
+#include <Arduino.h>
+#include <unity.h>
+#include "mqttqueue.cpp"
+
+static MQTTMessage state(const char* device, const char* payload) {
+    MQTTMessage message = MQTTMessage{device, payload, true};
+    message.coalesce = true;
+    return message;
+}
+
+static MQTTMessage summary(const char* payload) {
+    return MQTTMessage{"blecker/fusion/node/kitchen", payload, false, true};
+}
+
+void testCoalesceStatesOnly() {
+    MqttQueue queue;
+    queue.push(state("317234b9d2d0", "present"));
+    queue.push(summary("317234b9d2d0:-60"));
+    queue.push(summary("15172f81accc:-70"));        // second chunk of the same summary
+    queue.push(state("15172f81accc", "present"));
+    queue.push(state("317234b9d2d0", "not_present"));
+    TEST_ASSERT_EQUAL(4, queue.depth());
+    TEST_ASSERT_EQUAL(1, queue.getCoalesced());
+
+    // The coalesced state keeps its place, the chunks are all there in order
+    MQTTMessage message;
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("317234b9d2d0", message.topic.c_str());
+    TEST_ASSERT_EQUAL_STRING("not_present", message.payload.c_str());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("317234b9d2d0:-60", message.payload.c_str());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("15172f81accc:-70", message.payload.c_str());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("15172f81accc", message.topic.c_str());
+    TEST_ASSERT_FALSE(queue.pop(message));
+}
+
+// A state of every device fits (the first scan, a long outage), the new state is never the one which is lost
+void testCapacityAndFullQueue() {
+    MqttQueue queue;
+    TEST_ASSERT_EQUAL(MQTT_QUEUE_SIZE, queue.capacity());
+    const int devices = 200;
+    queue.setCapacity(devices + MQTT_QUEUE_SIZE);
+
+    char topic[16];
+    for (int i = 0; i < devices; i++) {
+        snprintf(topic, sizeof(topic), "device%d", i);
+        queue.push(state(topic, "present"));
+    }
+    TEST_ASSERT_EQUAL(devices, queue.depth());
+    TEST_ASSERT_EQUAL(0, queue.getDropped());
+
+    for (int i = 0; i < MQTT_QUEUE_SIZE; i++) {
+        queue.push(summary("317234b9d2d0:-60"));
+    }
+    // Full: the oldest not retained message goes first
+    queue.push(state("new", "present"));
+    TEST_ASSERT_EQUAL(1, queue.getDropped());
+    TEST_ASSERT_EQUAL(devices + MQTT_QUEUE_SIZE, queue.depth());
+
+    // Only retained states: the oldest state is replaced, the newest is kept
+    MqttQueue states;
+    for (int i = 0; i < MQTT_QUEUE_SIZE + 1; i++) {
+        snprintf(topic, sizeof(topic), "device%d", i);
+        states.push(state(topic, "present"));
+    }
+    TEST_ASSERT_EQUAL(1, states.getDropped());
+    MQTTMessage message;
+    TEST_ASSERT_TRUE(states.pop(message));
+    TEST_ASSERT_EQUAL_STRING("device1", message.topic.c_str());
+    while (states.pop(message)) {
+    }
+    TEST_ASSERT_EQUAL_STRING("device32", message.topic.c_str());
+}
+
+void testRequeue() {
+    MqttQueue queue;
+    queue.push(state("317234b9d2d0", "present"));
+    queue.push(summary("317234b9d2d0:-60"));
+
+    MQTTMessage message;
+    TEST_ASSERT_TRUE(queue.pop(message));
+    // Send failed: it goes back to the front
+    queue.requeue(message);
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("317234b9d2d0", message.topic.c_str());
+
+    // A newer state arrived meanwhile: the failed old one does not overwrite it
+    queue.push(state("317234b9d2d0", "not_present"));
+    queue.requeue(message);
+    TEST_ASSERT_EQUAL(2, queue.depth());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("317234b9d2d0:-60", message.payload.c_str());
+    TEST_ASSERT_TRUE(queue.pop(message));
+    TEST_ASSERT_EQUAL_STRING("not_present", message.payload.c_str());
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testCoalesceStatesOnly);
+    RUN_TEST(testCapacityAndFullQueue);
+    RUN_TEST(testRequeue);
+    return UNITY_END();
+}
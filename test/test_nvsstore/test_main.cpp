@@ -0,0 +1,128 @@
+// Settings store: only the changed values are written, the key index (STORE_INDEX_KEY) survives a reboot
+#include <Arduino.h>
+#include <unity.h>
+#include "nvsstore.cpp"
+
+static void fill(JsonDocument &document, const char* webhook) {
+    document.clear();
+    document["name"] = BOARD_NAME;
+    document["ssid"] = "home";
+    document["webhook"] = webhook;
+}
+
+void testChangedOnlyWrites() {
+    NvsStore store;
+    TEST_ASSERT_FALSE(store.begin());
+
+    StaticJsonDocument<512> document;
+    String rejected;
+    fill(document, "http://hook/1");
+    TEST_ASSERT_EQUAL(3, store.write(document, rejected));
+    // 3 values and the index
+    TEST_ASSERT_EQUAL_UINT32(4, Preferences::writes());
+
+    // Nothing changed: no write at all
+    TEST_ASSERT_EQUAL(0, store.write(document, rejected));
+    TEST_ASSERT_EQUAL_UINT32(4, Preferences::writes());
+
+    // One changed value, the index is not rewritten
+    fill(document, "http://hook/2");
+    TEST_ASSERT_EQUAL(1, store.write(document, rejected));
+    TEST_ASSERT_EQUAL_UINT32(5, Preferences::writes());
+
+    // A new key: the value and the index
+    document["room"] = "kitchen";
+    TEST_ASSERT_EQUAL(1, store.write(document, rejected));
+    TEST_ASSERT_EQUAL_UINT32(7, Preferences::writes());
+    TEST_ASSERT_EQUAL_UINT32(0, rejected.length());
+
+    StaticJsonDocument<512> stats;
+    store.fillStats(stats.to<JsonObject>());
+    TEST_ASSERT_EQUAL(5, stats["writes"].as<int>());
+    TEST_ASSERT_EQUAL(8, stats["skipped_writes"].as<int>());
+}
+
+// Over the NVS key limit: not written, reported to the caller
+void testLongKeyRejected() {
+    NvsStore store;
+    store.begin();
+
+    StaticJsonDocument<512> document;
+    String rejected;
+    fill(document, "");
+    document["averyveryverylongkey"] = "1";
+    TEST_ASSERT_EQUAL(3, store.write(document, rejected));
+    TEST_ASSERT_EQUAL_STRING("averyveryverylongkey", rejected.c_str());
+
+    StaticJsonDocument<512> stats;
+    store.fillStats(stats.to<JsonObject>());
+    TEST_ASSERT_EQUAL(1, stats["rejected_keys"].as<int>());
+    TEST_ASSERT_EQUAL(3, stats["keys"].as<int>());
+}
+
+void testIndexRoundTrip() {
+    {
+        NvsStore store;
+        store.begin();
+        StaticJsonDocument<512> document;
+        String rejected;
+        fill(document, "http://hook/1");
+        store.write(document, rejected);
+    }
+
+    Preferences preferences;
+    preferences.begin(STORE_NAMESPACE, true);
+    TEST_ASSERT_EQUAL_STRING("name" PARSE_CHAR "ssid" PARSE_CHAR "webhook", preferences.getString(STORE_INDEX_KEY).c_str());
+
+    // Reboot: the keys are found from the index
+    NvsStore store;
+    TEST_ASSERT_TRUE(store.begin());
+    StaticJsonDocument<512> document;
+    store.readAll(document);
+    TEST_ASSERT_EQUAL_STRING(BOARD_NAME, document["name"].as<const char*>());
+    TEST_ASSERT_EQUAL_STRING("home", document["ssid"].as<const char*>());
+    TEST_ASSERT_EQUAL_STRING("http://hook/1", document["webhook"].as<const char*>());
+
+    // A removed key is removed from the index too
+    store.remove("ssid");
+    TEST_ASSERT_EQUAL_STRING("name" PARSE_CHAR "webhook", preferences.getString(STORE_INDEX_KEY).c_str());
+    NvsStore rebooted;
+    TEST_ASSERT_TRUE(rebooted.begin());
+    document.clear();
+    rebooted.readAll(document);
+    TEST_ASSERT_FALSE(document.containsKey("ssid"));
+    TEST_ASSERT_TRUE(document.containsKey("webhook"));
+}
+
+// The document is full: reported, not truncated silently
+void testReadAllOverflow() {
+    NvsStore store;
+    store.begin();
+    StaticJsonDocument<512> document;
+    String rejected;
+    fill(document, "http://hook/1");
+    store.write(document, rejected);
+
+    StaticJsonDocument<JSON_OBJECT_SIZE(2)> small;
+    TEST_ASSERT_FALSE(store.readAll(small));
+    TEST_ASSERT_TRUE(store.readAll(document));
+}
+
+void setUp() {
+    Preferences preferences;
+    preferences.begin(STORE_NAMESPACE, false);
+    preferences.clear();
+    Preferences::writes() = 0;
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testChangedOnlyWrites);
+    RUN_TEST(testLongKeyRejected);
+    RUN_TEST(testIndexRoundTrip);
+    RUN_TEST(testReadAllOverflow);
+    return UNITY_END();
+}
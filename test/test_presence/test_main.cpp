@@ -0,0 +1,88 @@
+// Presence engine: reconcile of the device table with the observed device list
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "presence.cpp"
+
+struct CountingListener : PresenceListener {
+    int changes = 0;
+
+    void presenceChanged(const Device &device) {
+        changes++;
+    }
+};
+
+static Advertisement makeAdvertisement(uint64_t mac, uint32_t timestamp) {
+    Advertisement advertisement = {};
+    advertisement.mac = mac;
+    advertisement.timestamp = timestamp;
+    advertisement.rssi = -60;
+    return advertisement;
+}
+
+// Observed only mode with an empty list is the track everything mode, the devices are kept
+void testEmptyObservedList() {
+    CountingListener listener;
+    Presence presence;
+    presence.setup(listener, 0);
+    presence.advertisement(makeAdvertisement(0xA, 1000));
+    presence.advertisement(makeAdvertisement(0xB, 1000));
+
+    presence.setObserved(std::vector<uint64_t>(), 2000, true);
+    TEST_ASSERT_EQUAL(2, presence.size());
+    presence.advertisement(makeAdvertisement(0xC, 3000));
+    TEST_ASSERT_EQUAL(3, presence.size());
+
+    // With a list the other devices are dropped
+    presence.setObserved(std::vector<uint64_t>{0xB}, 4000, true);
+    TEST_ASSERT_EQUAL(1, presence.size());
+    TEST_ASSERT_EQUAL_UINT64(0xB, presence.get(0).mac);
+}
+
+static boolean contains(Presence &presence, uint64_t key) {
+    for (int i = 0; i < presence.size(); i++) {
+        if (presence.get(i).mac == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// A reconcile does not change the eviction order, the least recently seen device is evicted
+void testReconcileKeepsRecency() {
+    CountingListener listener;
+    Presence presence;
+    presence.setup(listener, 0);
+    presence.setCapacity(3);
+    presence.advertisement(makeAdvertisement(0xA, 1000));
+    presence.advertisement(makeAdvertisement(0xB, 2000));
+    presence.advertisement(makeAdvertisement(0xC, 3000));
+
+    presence.setObserved(std::vector<uint64_t>{0xB}, 4000, false);
+    presence.setObserved(std::vector<uint64_t>(), 5000, false);
+    presence.advertisement(makeAdvertisement(0xC, 6000));
+
+    // B is tracked again as the newest, A is the least recently seen
+    presence.advertisement(makeAdvertisement(0xD, 7000));
+    TEST_ASSERT_EQUAL(1, presence.getEvictions());
+    TEST_ASSERT_FALSE(contains(presence, 0xA));
+    TEST_ASSERT_TRUE(contains(presence, 0xB));
+    TEST_ASSERT_TRUE(contains(presence, 0xC));
+
+    presence.advertisement(makeAdvertisement(0xE, 8000));
+    TEST_ASSERT_FALSE(contains(presence, 0xB));
+    TEST_ASSERT_TRUE(contains(presence, 0xC));
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testEmptyObservedList);
+    RUN_TEST(testReconcileKeepsRecency);
+    return UNITY_END();
+}
@@ -0,0 +1,100 @@
+// MQTT reconnect schedule against broker stand-ins: refused connections and a black hole (every try blocks for the socket timeout)
+#include <Arduino.h>
+#include <unity.h>
+#include "reconnect.cpp"
+
+#define LOOP_STEP 10            // one loop() of the other subsystems (ms)
+
+struct OutageResult {
+    uint32_t attempts = 0;
+    uint32_t blocked = 0;           // ms the loop() spent in connect tries during the outage
+    uint32_t longestBlock = 0;
+    uint32_t reconnectDelay = 0;    // from the end of the outage to the connection
+    uint32_t resolves = 0;          // broker address lookups after a long outage
+};
+
+// The broker is down for outage ms, a connect try takes tryCost ms (0: refused at once, black hole: the socket timeout)
+static OutageResult simulateOutage(uint32_t outage, uint32_t tryCost) {
+    ReconnectBackoff backoff;
+    OutageResult result;
+    uint32_t now = 0;
+    backoff.reset();
+    while (true) {
+        if (backoff.due(now)) {
+            if (now >= outage) {
+                backoff.succeeded();
+                result.reconnectDelay = now - outage;
+                return result;
+            }
+            result.attempts++;
+            result.blocked += tryCost;
+            result.longestBlock = (tryCost > result.longestBlock) ? tryCost : result.longestBlock;
+            now += tryCost;
+            if (backoff.failed()) {
+                result.resolves++;
+            }
+        }
+        now += LOOP_STEP;
+    }
+}
+
+void testBackoffGrowsAndResets() {
+    ReconnectBackoff backoff;
+    TEST_ASSERT_TRUE(backoff.due(0));
+    TEST_ASSERT_FALSE(backoff.failed());
+    TEST_ASSERT_GREATER_OR_EQUAL(MQTT_BACKOFF_MIN / 2, backoff.getWait());
+    TEST_ASSERT_LESS_OR_EQUAL(MQTT_BACKOFF_MIN, backoff.getWait());
+    TEST_ASSERT_FALSE(backoff.due(backoff.getWait() - 1));
+    TEST_ASSERT_TRUE(backoff.due(backoff.getWait()));
+
+    for (int i = 0; i < 20; i++) {
+        backoff.failed();
+        TEST_ASSERT_LESS_OR_EQUAL(MQTT_BACKOFF_MAX, backoff.getWait());
+    }
+    TEST_ASSERT_EQUAL_UINT32(MQTT_BACKOFF_MAX, backoff.getBackoff());
+    TEST_ASSERT_TRUE(backoff.failed());
+
+    // New network: at once again
+    backoff.reset();
+    TEST_ASSERT_TRUE(backoff.due(0));
+    TEST_ASSERT_EQUAL_UINT32(MQTT_BACKOFF_MIN, backoff.getBackoff());
+    TEST_ASSERT_EQUAL_UINT32(3, backoff.getAttempts());
+    TEST_ASSERT_EQUAL_UINT32(22, backoff.getFailures());
+}
+
+// Half an hour without broker: the loop() is blocked only for a small part of the time, the broker is found again in a minute
+void testOutage() {
+    const uint32_t outage = 30 * 60 * 1000;
+    OutageResult refused = simulateOutage(outage, 0);
+    OutageResult blackHole = simulateOutage(outage, MQTT_SOCKET_TIMEOUT * 1000);
+
+    char line[160];
+    snprintf(line, sizeof(line), "Refused, 30 min: %u tries, reconnect %u ms after the broker is back",
+        refused.attempts, refused.reconnectDelay);
+    TEST_MESSAGE(line);
+    snprintf(line, sizeof(line), "Black hole, 30 min: %u tries, loop() blocked %.1f %% of the time (at most %u ms at once), reconnect after %u ms",
+        blackHole.attempts, 100.0 * blackHole.blocked / outage, blackHole.longestBlock, blackHole.reconnectDelay);
+    TEST_MESSAGE(line);
+
+    // Without backoff it was a try in every loop()
+    TEST_ASSERT_LESS_THAN(outage / (MQTT_BACKOFF_MAX / 2) + 16, refused.attempts);
+    TEST_ASSERT_LESS_OR_EQUAL(MQTT_BACKOFF_MAX + LOOP_STEP, refused.reconnectDelay);
+    TEST_ASSERT_LESS_THAN(outage / 15, blackHole.blocked);
+    TEST_ASSERT_EQUAL_UINT32(MQTT_SOCKET_TIMEOUT * 1000, blackHole.longestBlock);
+    TEST_ASSERT_LESS_OR_EQUAL(MQTT_BACKOFF_MAX + MQTT_SOCKET_TIMEOUT * 1000 + LOOP_STEP, blackHole.reconnectDelay);
+    // The address is looked up again during a long outage
+    TEST_ASSERT_GREATER_THAN(0, refused.resolves);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testBackoffGrowsAndResets);
+    RUN_TEST(testOutage);
+    return UNITY_END();
+}
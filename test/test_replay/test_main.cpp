@@ -0,0 +1,210 @@
+// Trace format round trip and the host replay through the presence logic
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "replay.h"
+
+static Advertisement makeAdvertisement(uint64_t mac, uint32_t timestamp, int8_t rssi, const char* name) {
+    Advertisement advertisement = {};
+    advertisement.mac = mac;
+    advertisement.address = mac;
+    advertisement.timestamp = timestamp;
+    advertisement.rssi = rssi;
+    strncpy(advertisement.name, name, DEVICE_NAME_LENGTH);
+    return advertisement;
+}
+
+// Trace in memory, written the same way as TraceRecorder does
+struct TraceBuilder {
+    std::vector<uint8_t> data;
+    uint32_t lastTimestamp = 0;
+
+    void header() {
+        uint8_t buffer[TRACE_HEADER_LENGTH];
+        data.insert(data.end(), buffer, buffer + traceWriteHeader(buffer));
+        lastTimestamp = 0;
+    }
+
+    void record(const Advertisement &advertisement) {
+        uint8_t buffer[TRACE_RECORD_MAX_LENGTH];
+        data.insert(data.end(), buffer, buffer + traceWriteRecord(buffer, advertisement, lastTimestamp));
+        lastTimestamp = advertisement.timestamp;
+    }
+};
+
+void testRoundTrip() {
+    Advertisement written = makeAdvertisement(0x317234b9d2d0ULL, 0x12345678, -67, "phone");
+    const uint8_t payload[] = {0x02, 0x01, 0x06, 0x03, 0x03, 0xAA, 0xFE};
+    memcpy(written.payload, payload, sizeof(payload));
+    written.payloadLength = sizeof(payload);
+
+    TraceBuilder trace;
+    trace.header();
+    trace.record(written);
+    trace.record(makeAdvertisement(0x15172f81acccULL, 0x12345678 + 300, -90, ""));
+
+    TraceReader reader(trace.data.data(), trace.data.size());
+    TEST_ASSERT_TRUE(reader.isValid());
+    Advertisement read;
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_EQUAL_UINT64(written.mac, read.mac);
+    TEST_ASSERT_EQUAL_UINT32(written.timestamp, read.timestamp);
+    TEST_ASSERT_EQUAL(-67, read.rssi);
+    TEST_ASSERT_EQUAL_STRING("phone", read.name);
+    TEST_ASSERT_EQUAL(sizeof(payload), read.payloadLength);
+    TEST_ASSERT_EQUAL_MEMORY(payload, read.payload, sizeof(payload));
+
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_EQUAL_UINT64(0x15172f81acccULL, read.mac);
+    TEST_ASSERT_EQUAL_UINT32(0x12345678 + 300, read.timestamp);
+    TEST_ASSERT_EQUAL_STRING("", read.name);
+    TEST_ASSERT_FALSE(reader.next(read));
+}
+
+void testReconnectAndTruncation() {
+    TraceBuilder trace;
+    trace.header();
+    trace.record(makeAdvertisement(1, 5000, -60, ""));
+    // Recorder reconnected: new header, absolute time again
+    trace.header();
+    trace.record(makeAdvertisement(2, 9000, -60, ""));
+    trace.record(makeAdvertisement(3, 9100, -60, "cut"));
+    trace.data.resize(trace.data.size() - 2);
+
+    TraceReader reader(trace.data.data(), trace.data.size());
+    Advertisement read;
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_EQUAL_UINT32(5000, read.timestamp);
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_EQUAL_UINT64(2, read.mac);
+    TEST_ASSERT_EQUAL_UINT32(9000, read.timestamp);
+    // Interrupted recording
+    TEST_ASSERT_FALSE(reader.next(read));
+
+    const uint8_t foreign[] = {'B', 'L', 'E', 'T', TRACE_FORMAT_VERSION + 1, 0};
+    TraceReader other(foreign, sizeof(foreign));
+    TEST_ASSERT_FALSE(other.isValid());
+}
+
+// Delta 0x42 ("B") and an address starting with 4c:45:54 ("LET"): it is a record, not a header
+void testHeaderLookalike() {
+    TraceBuilder trace;
+    trace.header();
+    trace.record(makeAdvertisement(1, 1000, -60, ""));
+    trace.record(makeAdvertisement(0x4c4554020000ULL, 1000 + 0x42, -60, ""));
+    trace.record(makeAdvertisement(3, 1100, -60, ""));
+
+    TraceReader reader(trace.data.data(), trace.data.size());
+    Advertisement read;
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_EQUAL_UINT64(0x4c4554020000ULL, read.mac);
+    TEST_ASSERT_EQUAL_UINT32(1000 + 0x42, read.timestamp);
+    TEST_ASSERT_TRUE(reader.next(read));
+    TEST_ASSERT_EQUAL_UINT32(1100, read.timestamp);
+    TEST_ASSERT_FALSE(reader.next(read));
+}
+
+void testReplayTransitions() {
+    // Device A every second for a minute, device B once
+    TraceBuilder trace;
+    trace.header();
+    trace.record(makeAdvertisement(0xB, 1000, -70, ""));
+    for (uint32_t i = 0; i < 60; i++) {
+        trace.record(makeAdvertisement(0xA, 1000 + i * 1000, -60, "a"));
+    }
+
+    std::vector<ReplayTransition> transitions;
+    Replay replay([&transitions](const ReplayTransition &transition) {
+        transitions.push_back(transition);
+    });
+    TraceReader reader(trace.data.data(), trace.data.size());
+    ReplayStats stats = replay.run(reader, 0, BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT + BT_DEVICE_TIMEOUT);
+
+    TEST_ASSERT_EQUAL(61, stats.advertisements);
+    TEST_ASSERT_EQUAL(4, transitions.size());
+    TEST_ASSERT_EQUAL_UINT64(0xB, transitions[0].key);
+    TEST_ASSERT_TRUE(transitions[0].available);
+    TEST_ASSERT_EQUAL_UINT64(0xA, transitions[1].key);
+    TEST_ASSERT_TRUE(transitions[1].available);
+
+    // Fixed timeout: gone after DEVICE_DROP_OUT_COUNT * BT_DEVICE_TIMEOUT (timer wheel resolution)
+    TEST_ASSERT_EQUAL_UINT64(0xB, transitions[2].key);
+    TEST_ASSERT_FALSE(transitions[2].available);
+    uint32_t departure = transitions[2].time - transitions[2].lastSeen;
+    TEST_ASSERT_GREATER_OR_EQUAL(BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT, departure);
+    TEST_ASSERT_LESS_OR_EQUAL(BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT + 2 * BT_TIMER_WHEEL_RESOLUTION, departure);
+    TEST_ASSERT_EQUAL_UINT64(0xA, transitions[3].key);
+    TEST_ASSERT_FALSE(transitions[3].available);
+    TEST_ASSERT_EQUAL_UINT32(60000, transitions[3].lastSeen);
+}
+
+void testReplayObservedOnly() {
+    TraceBuilder trace;
+    trace.header();
+    trace.record(makeAdvertisement(0xA, 1000, -60, ""));
+    trace.record(makeAdvertisement(0xB, 1000, -60, ""));
+
+    std::vector<ReplayTransition> transitions;
+    Replay replay([&transitions](const ReplayTransition &transition) {
+        transitions.push_back(transition);
+    });
+    replay.setObserved(std::vector<uint64_t>{0xB, 0xC});
+    TraceReader reader(trace.data.data(), trace.data.size());
+    replay.run(reader, 0, BT_DEVICE_TIMEOUT * DEVICE_DROP_OUT_COUNT + BT_DEVICE_TIMEOUT);
+
+    // Only the observed devices, C never showed up
+    for (size_t i = 0; i < transitions.size(); i++) {
+        TEST_ASSERT_TRUE(transitions[i].key == 0xB || transitions[i].key == 0xC);
+    }
+    TEST_ASSERT_EQUAL(3, transitions.size());
+}
+
+// The trace has the advertised addresses, the replay resolves them (sample data of the Core Spec, see test_rpa)
+void testReplayResolvesPrivateAddresses() {
+    const uint64_t phone = 0x317234b9d2d0ULL;
+    const uint64_t privateAddress = (0x708194ULL << 24) | 0x0dfbaa;
+    IdentityResolvingKey irk = {phone, {0xec, 0x02, 0x34, 0xa3, 0x57, 0xc8, 0xad, 0x05, 0x34, 0x10, 0x10, 0xa6, 0x0a, 0x39, 0x7d, 0x9b}};
+
+    TraceBuilder trace;
+    trace.header();
+    Advertisement advertisement = makeAdvertisement(privateAddress, 1000, -60, "");
+    advertisement.randomAddress = true;
+    trace.record(advertisement);
+    // Same bits as a public address: not resolved, filtered
+    trace.record(makeAdvertisement(privateAddress, 2000, -60, ""));
+    trace.record(makeAdvertisement(0xA, 3000, -60, ""));
+
+    std::vector<ReplayTransition> transitions;
+    Replay replay([&transitions](const ReplayTransition &transition) {
+        transitions.push_back(transition);
+    });
+    replay.setObserved(std::vector<uint64_t>{0xB});
+    replay.setIdentityResolvingKeys(std::vector<IdentityResolvingKey>{irk});
+    TraceReader reader(trace.data.data(), trace.data.size());
+    ReplayStats stats = replay.run(reader, 0, 0);
+
+    TEST_ASSERT_EQUAL(1, stats.advertisements);
+    TEST_ASSERT_EQUAL(2, stats.filtered);
+    TEST_ASSERT_EQUAL(1, replay.getResolver().getResolved());
+    TEST_ASSERT_EQUAL(1, transitions.size());
+    TEST_ASSERT_EQUAL_UINT64(phone, transitions[0].key);
+    TEST_ASSERT_TRUE(transitions[0].available);
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testRoundTrip);
+    RUN_TEST(testReconnectAndTruncation);
+    RUN_TEST(testHeaderLookalike);
+    RUN_TEST(testReplayTransitions);
+    RUN_TEST(testReplayObservedOnly);
+    RUN_TEST(testReplayResolvesPrivateAddresses);
+    return UNITY_END();
+}
@@ -0,0 +1,115 @@
+// Resolvable private address resolution: the ah() sample data of the Core Spec (Vol 3, Part H, D.7) and the cache
+#include <Arduino.h>
+#include <unity.h>
+#include <vector>
+#include "rpa.cpp"
+
+// Sample data: IRK ec0234a357c8ad05341010a60a397d9b, prand 0x708194, hash 0x0dfbaa
+static const uint8_t SAMPLE_IRK[16] = {0xec, 0x02, 0x34, 0xa3, 0x57, 0xc8, 0xad, 0x05, 0x34, 0x10, 0x10, 0xa6, 0x0a, 0x39, 0x7d, 0x9b};
+static const uint64_t SAMPLE_ADDRESS = (0x708194ULL << 24) | 0x0dfbaa;
+static const uint64_t DEVICE_KEY = 0x317234b9d2d0ULL;
+
+static std::vector<IdentityResolvingKey> sampleKeys() {
+    IdentityResolvingKey other = {0x15172f81acccULL, {0}};
+    IdentityResolvingKey sample = {DEVICE_KEY, {0}};
+    memcpy(sample.irk, SAMPLE_IRK, sizeof(SAMPLE_IRK));
+    return std::vector<IdentityResolvingKey>{other, sample};
+}
+
+// Random, resolvable (top bits 01) addresses which do not belong to the sample key
+static uint64_t foreignAddress(uint32_t i) {
+    return (0x400000ULL | ((i * 2654435761u) & 0x3FFFFF)) << 24 | ((i * 40503u) & 0xFFFFFF);
+}
+
+void testAh() {
+    TEST_ASSERT_EQUAL_HEX32(0x0dfbaa, RpaResolver::ah(SAMPLE_IRK, 0x708194));
+}
+
+void testAddressType() {
+    TEST_ASSERT_TRUE(RpaResolver::isResolvable(SAMPLE_ADDRESS, true));
+    // Same bits with public address type
+    TEST_ASSERT_FALSE(RpaResolver::isResolvable(SAMPLE_ADDRESS, false));
+    // Static random and non-resolvable private addresses
+    TEST_ASSERT_FALSE(RpaResolver::isResolvable(0xC00000000001ULL, true));
+    TEST_ASSERT_FALSE(RpaResolver::isResolvable(0x000000000001ULL, true));
+}
+
+void testResolve() {
+    RpaResolver resolver;
+    TEST_ASSERT_EQUAL_UINT64(0, resolver.resolve(SAMPLE_ADDRESS, true));     // no keys yet
+
+    resolver.setKeys(sampleKeys());
+    TEST_ASSERT_EQUAL_UINT64(DEVICE_KEY, resolver.resolve(SAMPLE_ADDRESS, true));
+    TEST_ASSERT_EQUAL_UINT64(0, resolver.resolve(SAMPLE_ADDRESS, false));
+    TEST_ASSERT_EQUAL_UINT64(0, resolver.resolve(foreignAddress(1), true));
+    TEST_ASSERT_EQUAL(1, resolver.getResolved());
+
+    // Cached: no more AES operations
+    uint32_t operations = resolver.getAesOperations();
+    TEST_ASSERT_EQUAL_UINT64(DEVICE_KEY, resolver.resolve(SAMPLE_ADDRESS, true));
+    TEST_ASSERT_EQUAL_UINT64(0, resolver.resolve(foreignAddress(1), true));
+    TEST_ASSERT_EQUAL_UINT32(operations, resolver.getAesOperations());
+    TEST_ASSERT_EQUAL_UINT32(2, resolver.getHits());
+
+    // New keys invalidate the cache
+    resolver.setKeys(std::vector<IdentityResolvingKey>(1, sampleKeys()[0]));
+    TEST_ASSERT_EQUAL_UINT64(0, resolver.resolve(SAMPLE_ADDRESS, true));
+    resolver.setKeys(std::vector<IdentityResolvingKey>());
+    TEST_ASSERT_EQUAL_UINT64(0, resolver.resolve(SAMPLE_ADDRESS, true));
+}
+
+void testCacheSize() {
+    RpaResolver resolver;
+    TEST_ASSERT_EQUAL(RPA_CACHE_MIN_SIZE, resolver.getCacheSize());
+    resolver.setCacheSize(100);
+    TEST_ASSERT_EQUAL(128, resolver.getCacheSize());
+    resolver.setCacheSize(BT_MAX_DEVICES);
+    TEST_ASSERT_EQUAL(RPA_CACHE_MAX_SIZE, resolver.getCacheSize());
+}
+
+// The devices in range fit into the cache: after the first round almost every advertisement is a hit,
+// even when there are more devices than the earlier fixed size FIFO had entries
+void testCacheHoldsDevicesInRange() {
+    RpaResolver resolver;
+    resolver.setCacheSize(128);
+    resolver.setKeys(sampleKeys());
+    const uint32_t devices = 96;
+    for (uint32_t i = 0; i < devices; i++) {
+        resolver.resolve(foreignAddress(i), true);
+    }
+    uint32_t misses = resolver.getMisses();
+    for (uint32_t round = 0; round < 10; round++) {
+        for (uint32_t i = 0; i < devices; i++) {
+            resolver.resolve(foreignAddress(i), true);
+        }
+        // A new device passing by
+        resolver.resolve(foreignAddress(devices + round), true);
+    }
+    uint32_t later = resolver.getMisses() - misses;
+    TEST_ASSERT_LESS_THAN(10 * devices / 10, later);
+
+    // Recently used entries survive the passing devices
+    TEST_ASSERT_EQUAL_UINT64(DEVICE_KEY, resolver.resolve(SAMPLE_ADDRESS, true));
+    uint32_t operations = resolver.getAesOperations();
+    for (uint32_t i = 0; i < devices; i++) {
+        resolver.resolve(SAMPLE_ADDRESS, true);
+        resolver.resolve(foreignAddress(1000 + i), true);
+    }
+    TEST_ASSERT_EQUAL_UINT32(operations + devices * 2, resolver.getAesOperations());
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testAh);
+    RUN_TEST(testAddressType);
+    RUN_TEST(testResolve);
+    RUN_TEST(testCacheSize);
+    RUN_TEST(testCacheHoldsDevicesInRange);
+    return UNITY_END();
+}
@@ -0,0 +1,58 @@
+// Snapshot document: escaped presence payloads, truncation of the device list
+#include <Arduino.h>
+#include <unity.h>
+#include "snapshot.cpp"
+
+void testJsonEscape() {
+    char buffer[JSON_ESCAPED_LENGTH(16) + 1];
+    jsonEscape("say \"hi\"\\", buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("say \\\"hi\\\"\\\\", buffer);
+    jsonEscape("a\nb", buffer, sizeof(buffer));
+    TEST_ASSERT_EQUAL_STRING("a\\u000ab", buffer);
+
+    // Truncated at a whole character, not in an escape sequence
+    char small[4];
+    TEST_ASSERT_EQUAL(3, jsonEscape("a\"b", small, sizeof(small)));
+    TEST_ASSERT_EQUAL_STRING("a\\\"", small);
+    TEST_ASSERT_EQUAL(1, jsonEscape("a\nb", small, sizeof(small)));
+}
+
+void testEscapedPayloads() {
+    char present[JSON_ESCAPED_LENGTH(CONFIG_STRING_LENGTH) + 1];
+    jsonEscape("at \"home\"", present, sizeof(present));
+
+    Snapshot snapshot;
+    snapshot.addChange(0x317234b9d2d0ULL, true);
+    snapshot.addChange(0x15172f81acccULL, false);
+    snapshot.begin(12, present, "away\\\\");
+    snapshot.addDevice(0x317234b9d2d0ULL, -67);
+    TEST_ASSERT_EQUAL_STRING("{\"cycle\":12,\"changes\":{\"317234b9d2d0\":\"at \\\"home\\\"\",\"15172f81accc\":\"away\\\\\"},"
+        "\"devices\":{\"317234b9d2d0\":-67},\"truncated\":0}", snapshot.finish());
+}
+
+void testTruncated() {
+    Snapshot snapshot;
+    snapshot.begin(1, "home", "not_home");
+    int devices = BATCH_MAX_PAYLOAD / 20 + 10;
+    for (int i = 0; i < devices; i++) {
+        snapshot.addDevice(0x24A160000000ULL + i, -70);
+    }
+    const char* document = snapshot.finish();
+    TEST_ASSERT_LESS_OR_EQUAL(BATCH_MAX_PAYLOAD, strlen(document));
+    TEST_ASSERT_EQUAL_STRING("}", document + strlen(document) - 1);
+    TEST_ASSERT_NOT_NULL(strstr(document, "\"truncated\":"));
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(testJsonEscape);
+    RUN_TEST(testEscapedPayloads);
+    RUN_TEST(testTruncated);
+    return UNITY_END();
+}
@@ -0,0 +1,95 @@
+// Host replay of an advertisement trace through the presence logic.
+// Build (from the project folder):
+//   g++ -std=gnu++17 -O2 -I src -I test/stubs tools/replay/main.cpp -o replay
+// Usage:
+//   replay [-s speed] [-o observed devices] [-k identity resolving keys] [-c confidence] [-f floor] [-t ceiling] [-b] [-q] <trace file>
+//   -s  N times the real time (default: as fast as possible)
+//   -o  observed devices, the format of the web interface (317234b9d2d0;15172f81accc)
+//   -k  Identity Resolving Keys, the format of the web interface (317234b9d2d0=ec0234a357c8ad05341010a60a397d9b)
+//   -c  adaptive departure timeout confidence in percent, -f / -t its floor / ceiling in seconds (see PresenceConfig)
+//   -b  key the beacons on their identity
+//   -q  print the summary only
+// Output: one line per state change (trace time in seconds, device, state), like the MQTT messages of the node.
+#include <Arduino.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "replay.h"
+
+int main(int argc, char **argv) {
+    double speed = 0;
+    boolean quiet = false;
+    PresenceConfig config;
+    std::vector<uint64_t> observed;
+    std::vector<IdentityResolvingKey> irks;
+
+    int option;
+    while ((option = getopt(argc, argv, "s:o:k:c:f:t:bq")) != -1) {
+        switch (option) {
+            case 's': speed = atof(optarg); break;
+            case 'c': config.confidence = atoi(optarg); break;
+            case 'f': config.timeoutFloor = atoi(optarg) * 1000; break;
+            case 't': config.timeoutCeiling = atoi(optarg) * 1000; break;
+            case 'b': config.beaconIdentity = true; break;
+            case 'q': quiet = true; break;
+            case 'o': {
+                for (char *device = strtok(optarg, PARSE_CHAR); device != NULL; device = strtok(NULL, PARSE_CHAR)) {
+                    uint64_t key;
+                    if (!parseDeviceId(device, key)) {
+                        fprintf(stderr, "Invalid observed device: %s\n", device);
+                        return 2;
+                    }
+                    observed.push_back(key);
+                }
+                break;
+            }
+            case 'k': {
+                for (char *entry = strtok(optarg, PARSE_CHAR); entry != NULL; entry = strtok(NULL, PARSE_CHAR)) {
+                    IdentityResolvingKey irk;
+                    if (!parseIdentityResolvingKey(entry, irk)) {
+                        fprintf(stderr, "Invalid Identity Resolving Key entry: %s\n", entry);
+                        return 2;
+                    }
+                    irks.push_back(irk);
+                }
+                break;
+            }
+            default:
+                fprintf(stderr, "Usage: %s [-s speed] [-o observed devices] [-k identity resolving keys] [-c confidence] [-f floor] [-t ceiling] [-b] [-q] <trace file>\n", argv[0]);
+                return 2;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "Trace file is missing\n");
+        return 2;
+    }
+
+    std::ifstream file(argv[optind], std::ios::binary);
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    TraceReader reader(data.data(), data.size());
+    if (!file || !reader.isValid()) {
+        fprintf(stderr, "%s is not a trace (version %d)\n", argv[optind], TRACE_FORMAT_VERSION);
+        return 1;
+    }
+
+    Replay replay([quiet](const ReplayTransition &transition) {
+        if (!quiet) {
+            char key[KEY_STRING_LENGTH + 1];
+            formatKey(transition.key, key);
+            printf("%10.3f %s %s\n", transition.time / 1000.0, key, transition.available ? DEFAULT_PRESENT : DEFAULT_NOT_PRESENT);
+        }
+    });
+    replay.configure(config);
+    replay.setObserved(observed);
+    replay.setIdentityResolvingKeys(irks);
+
+    // Long enough for the departure of every device
+    ReplayStats stats = replay.run(reader, speed, config.timeoutCeiling + BT_DEVICE_TIMEOUT);
+
+    fprintf(stderr, "%u advertisements (%u filtered), %u state changes, %.1f s of trace in %.3f s (%.0f advertisements/s, %.0fx real time)\n",
+        stats.advertisements, stats.filtered, stats.transitions, stats.traceTime / 1000.0, stats.seconds,
+        stats.advertisements / (stats.seconds > 0 ? stats.seconds : 1), stats.traceTime / 1000.0 / (stats.seconds > 0 ? stats.seconds : 1));
+    return 0;
+}
@@ -0,0 +1,147 @@
+#ifndef REPLAY
+#define REPLAY
+
+#include <Arduino.h>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "presence.cpp"
+#include "intake.cpp"
+#include "traceformat.cpp"
+
+// Feeds a recorded advertisement trace (see traceformat.cpp) through the presence logic, the same code what runs
+// on the ESP32 (BleScanner::onResult and BlueTooth::loop): the recorded address is resolved and filtered, then every
+// advertisement goes to Presence::advertisement() with its recorded time and Presence::loop() is called in
+// REPLAY_LOOP_STEP steps between them.
+#define REPLAY_LOOP_STEP 100
+
+struct ReplayTransition {
+    uint32_t time;          // trace time (ms) of the state change
+    uint64_t key;
+    boolean available;
+    uint32_t lastSeen;      // trace time of the last advertisement of the device
+};
+
+struct ReplayStats {
+    uint32_t advertisements = 0;
+    uint32_t filtered = 0;          // dropped by the observed only filter (not counted in the advertisements)
+    uint32_t transitions = 0;
+    uint32_t traceTime = 0;         // milliseconds of the trace (+ the tail)
+    double seconds = 0;             // wall clock time of the replay
+};
+
+class Replay : public PresenceListener {
+
+    Presence presence;
+    PresenceConfig config;
+    std::vector<uint64_t> observed;
+    std::vector<IdentityResolvingKey> irks;
+    RpaResolver resolver;
+    MacFilter filter;
+    int capacity = 0;
+    std::function<void(const ReplayTransition&)> output;
+    ReplayStats stats;
+    uint32_t now = 0;
+
+    public:
+        Replay(std::function<void(const ReplayTransition&)> output) : output(output) {
+        }
+
+        void configure(const PresenceConfig &config) {
+            this -> config = config;
+        }
+
+        // Observed only mode, see Presence::setObserved()
+        void setObserved(const std::vector<uint64_t> &keys) {
+            this -> observed = keys;
+        }
+
+        // Resolvable private addresses of these devices are reported with the key of the device (they are observed too)
+        void setIdentityResolvingKeys(const std::vector<IdentityResolvingKey> &keys) {
+            this -> irks = keys;
+        }
+
+        void setCapacity(int capacity) {
+            this -> capacity = capacity;
+        }
+
+        RpaResolver& getResolver() {
+            return resolver;
+        }
+
+        // speed: 0 as fast as possible, N: N times the real time
+        // tail: the replay goes on after the last record (milliseconds), so the departures are reported too
+        ReplayStats run(TraceReader &reader, double speed, uint32_t tail) {
+            stats = ReplayStats();
+            auto wallStart = std::chrono::steady_clock::now();
+
+            Advertisement advertisement;
+            boolean more = reader.next(advertisement);
+            uint32_t start = more ? advertisement.timestamp : 0;
+            now = start;
+            presence.configure(config);
+            presence.setCapacity(capacity);
+            presence.setup(*this, start);
+            // Like BlueTooth::fillDevices()
+            std::vector<uint64_t> keys = observed;
+            for (size_t i = 0; i < irks.size(); i++) {
+                keys.push_back(irks[i].key);
+            }
+            presence.setObserved(keys, start, !observed.empty());
+            resolver.setCacheSize(capacity);
+            resolver.setKeys(irks);
+            filter.set(observed.empty() ? std::vector<uint64_t>() : keys);
+
+            uint32_t offset = 0;
+            while (more) {
+                // Time base of a restarted recorder (reboot of the node): the records go on from the current time
+                advertisement.timestamp += offset;
+                if (!timeReached(advertisement.timestamp, now)) {
+                    offset += now - advertisement.timestamp;
+                    advertisement.timestamp = now;
+                }
+                advance(advertisement.timestamp, start, speed, wallStart);
+                // The trace has the advertised address, resolved and filtered here like by the scanner
+                if (admitAdvertisement(resolver, filter, advertisement.address, advertisement.randomAddress,
+                        advertisement.payload, advertisement.payloadLength, advertisement.mac, advertisement.identity)) {
+                    presence.advertisement(advertisement);
+                    stats.advertisements++;
+                } else {
+                    stats.filtered++;
+                }
+                more = reader.next(advertisement);
+            }
+            advance(now + tail, start, speed, wallStart);
+
+            stats.traceTime = now - start;
+            stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+            return stats;
+        }
+
+        Presence& getPresence() {
+            return presence;
+        }
+
+        void presenceChanged(const Device &device) override {
+            stats.transitions++;
+            output(ReplayTransition{now, device.mac, device.available, device.lastSeen});
+        }
+
+    private:
+        void advance(uint32_t until, uint32_t start, double speed, std::chrono::steady_clock::time_point wallStart) {
+            while (timeReached(until, now + REPLAY_LOOP_STEP)) {
+                now += REPLAY_LOOP_STEP;
+                presence.loop(now);
+            }
+            now = until;
+            presence.loop(now);
+
+            if (speed > 0) {
+                auto due = wallStart + std::chrono::duration<double, std::milli>((now - start) / speed);
+                std::this_thread::sleep_until(due);
+            }
+        }
+};
+
+#endif